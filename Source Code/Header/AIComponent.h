@@ -3,7 +3,7 @@
 
 #include "Component.h"
 #include "BehaviourTree.h"
-#include "Entity.h"
+#include "EntityManager.h"
 #include <vector>
 #include "AiInputComponent.h"
 #include "PlayerComponent.h"
@@ -12,22 +12,34 @@
 class AIComponent : public Component
 {
 public:
-	AIComponent(std::vector<Entity *>* e, AiInputComponent * i, Entity * self, PlayerComponent * p, Box2DBridge & world) :
+	AIComponent(std::vector<Entity *>* e, AiInputComponent * i, Entity * self, PlayerComponent * p, EntityManager* entities) :
 		m_entities(e),
+		m_entitiesPtr(entities),
 		m_input(i),
 		m_self(self),
 		m_player(p),
-		m_world(world)
+		m_right(nullptr),
+		m_left(nullptr)
 	{
-		m_left = new PhysicsComponent(static_cast<PositionComponent *>(&self->getComponent("Pos")));
-		m_right = new PhysicsComponent(static_cast<PositionComponent *>(&self->getComponent("Pos")));
-		auto pos = static_cast<PositionComponent *>(&self->getComponent("Pos"))->position;
-		m_left->m_body = m_world.createBox(pos.x, pos.y, 30, 78, false, false, b2_dynamicBody);
-		m_world.addProperties(*m_left->m_body, 0, 0, 0, true, new PhysicsComponent::ColData("Left Edge Sensor", m_self));
-		m_right->m_body = m_world.createBox(pos.x, pos.y, 30, 78, false, false, b2_dynamicBody);
-		m_world.addProperties(*m_right->m_body, 0, 0, 0, true, new PhysicsComponent::ColData("Right Edge Sensor", m_self));
 	}
-	~AIComponent() {}
+
+	//Adds the edge sensors to either side of the AI's body, they lose the ground when the AI is at an edge
+	void createEdgeSensors(Box2DBridge& world, Box2DBody& body)
+	{
+		m_left = world.addSensor(body, -45, 1, 30, 78, new PhysicsComponent::ColData("Left Edge Sensor", m_self));
+		m_right = world.addSensor(body, 45, 1, 30, 78, new PhysicsComponent::ColData("Right Edge Sensor", m_self));
+	}
+	~AIComponent()
+	{
+		for (auto action : m_actions)
+			delete action;
+	}
+
+	//The tree's leaves are made on the heap when the tree is built, the component deletes them with itself
+	BehaviourTree::Node* own(BehaviourTree::Node* action) { m_actions.push_back(action); return action; }
+
+	//The player this AI is going after, nullptr if they have been knocked out
+	Entity* nearest() { return m_entitiesPtr->get(nearestPlayer); }
 
 	//Declare Tree, selector nodes and sequence nodes
 	BehaviourTree BT;
@@ -36,14 +48,15 @@ public:
 	BehaviourTree::Sequence m_sequences[3];
 	BehaviourTree::Sequence punchSequence;
 	BehaviourTree::Succeeder m_succeeders[3];
+	std::vector<BehaviourTree::Node*> m_actions; //The leaves of the tree, the other nodes are members
 	std::vector<Entity *>* m_entities;
 	Entity * m_self;
-	Entity * nearestPlayer;
+	EntityHandle nearestPlayer;
+	EntityManager* m_entitiesPtr;
 	AiInputComponent * m_input;
 	PlayerComponent * m_player;
-	PhysicsComponent * m_right;
-	PhysicsComponent * m_left;
-	Box2DBridge m_world;
+	b2Fixture * m_right;
+	b2Fixture * m_left;
 
 	bool onEdgeLeft = false;
 	bool onEdgeRight = false;
@@ -1,15 +1,24 @@
 #ifndef AISYSTEM_H
 #define AISYSTEM_H
 
-#include "System.h"
+#include "TypedSystem.h"
 #include "AIComponent.h"
 
-class AISystem : public System 
+class AISystem : public TypedSystem<AIComponent>
 {
 public:
-	void createTree();
+	void createTree(AIComponent* cast_comp);
 	void runTree();
 	void update(double dt);
+
+	//The behaviour tree only presses buttons on the AI's input, the commands that animate and move the player run
+	//from the input handling before the systems. Leaving the DJ booth moves the AI and clears its flag
+	SystemAccess access() const override
+	{
+		return SystemAccess().write<AIComponent>().write<AiInputComponent>().write<PositionComponent>().write<PlayerComponent>()
+			.read<PlayerPhysicsComponent>()
+			.writeResource(SystemAccess::RANDOM);
+	}
 	void addComponent(Component *);
 private:
 	float timer = 0;
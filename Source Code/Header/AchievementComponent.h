@@ -35,7 +35,7 @@ public:
 				//If the achievement is not unlocked, unlock it
 				if (pair.second == false)
 				{
-					achi::Listener::m_newUnlocks.push_back(name);
+					m_newUnlocks.push_back(name);
 					std::cout << "Unlocked achievement: " << name << "\n";
 					pair.second = true;
 				}
@@ -67,6 +67,7 @@ public:
 	}
 
 	std::map<std::string, bool> m_achievements;
+	std::vector<std::string> m_newUnlocks; //Unlocked since the game last showed them
 private:
 	json* m_data;
 };
\ No newline at end of file
@@ -8,6 +8,7 @@
 #include "AIComponent.h"
 #include "AiInputComponent.h"
 #include "PlayerPhysicsComponent.h"
+#include "Random.h"
 
 /// <summary>
 /// Action base class. All other concrete action
@@ -106,7 +107,7 @@ public:
 	/// <returns></returns>
 	bool run() override
 	{
-		auto phys = static_cast<PlayerPhysicsComponent *>(&m_entity->getComponent("Player Physics"));
+		auto phys = m_entity->get<PlayerPhysicsComponent>();
 		//Passes YBTN command to AI input handler
 		if (phys->canJump())
 		{
@@ -136,7 +137,7 @@ public:
 	/// <returns></returns>
 	bool run() override
 	{
-		auto p = static_cast<PlayerPhysicsComponent *>(&m_entity->getComponent("Player Physics"));
+		auto p = m_entity->get<PlayerPhysicsComponent>();
 
 		m_input->m_current["ABTN"] = false;
 		m_input->m_current["XBTN"] = true;
@@ -188,7 +189,7 @@ public:
 	bool run() override
 	{
 		//Container to store nearest entity
-		auto nearest = new Entity("temp");
+		Entity* nearest = nullptr;
 
 		//If entities vector is not empty, set nearest to first element
 		if (!m_entities->empty())
@@ -196,9 +197,9 @@ public:
 			nearest = m_entities->at(0);
 
 			//Get position component of current AI entity
-			auto self_pos = dynamic_cast<PositionComponent *>(&m_entity->getComponent("Pos"));
+			auto self_pos = m_entity->get<PositionComponent>();
 			//Get position component from entity
-			auto otherPos = dynamic_cast<PositionComponent *>(&nearest->getComponent("Pos"));
+			auto otherPos = nearest->get<PositionComponent>();
 
 			//Loop through all entities
 			for (auto entity : *m_entities)
@@ -206,7 +207,7 @@ public:
 				if (entity != m_entity)
 				{
 					//Get position component of the current entity in the loop
-					auto newPos = dynamic_cast<PositionComponent *>(&entity->getComponent("Pos"));
+					auto newPos = entity->get<PositionComponent>();
 					//Check distance between self and previous position, and self and new position
 					if (dist(newPos->position, self_pos->position) < dist(otherPos->position, self_pos->position))
 					{
@@ -216,10 +217,9 @@ public:
 				}
 			}
 			//Cast AI component
-			auto e = dynamic_cast<AIComponent *>(&m_entity->getComponent("AI"));
+			auto e = m_entity->get<AIComponent>();
 			//Assign nearest player to variable in the AI 
-			e->nearestPlayer = nearest;
-			//delete nearest;
+			e->nearestPlayer = nearest->handle();
 			return true;
 		}
 		return false;
@@ -248,11 +248,16 @@ public:
 	bool run() override
 	{
 		//Get AI component
-		auto comp = dynamic_cast<AIComponent *>(&m_entity->getComponent("AI"));
+		auto comp = m_entity->get<AIComponent>();
 		//Cast self component to PositionComponent
-		auto pos = dynamic_cast<PositionComponent *>(&m_entity->getComponent("Pos"));
+		auto pos = m_entity->get<PositionComponent>();
+		//Fail if the nearest player has been knocked out since we last checked
+		auto nearestPlayer = comp->nearest();
+		if (nullptr == nearestPlayer)
+			return false;
+
 		//Cast nearest player entity from Ai component to Position component
-		auto nearest = dynamic_cast<PositionComponent *>(&comp->nearestPlayer->getComponent("Pos"));
+		auto nearest = nearestPlayer->get<PositionComponent>();
 		//Return true if dist between two entities is less than 100
 		return dist(pos->position, nearest->position) < 50 ? true : false;
 	}
@@ -286,13 +291,18 @@ public:
 	bool run() override
 	{
 		//Get AI component
-		auto comp = dynamic_cast<AIComponent *>(&m_entity->getComponent("AI"));
+		auto comp = m_entity->get<AIComponent>();
 
 		//Cast self component to PositionComponent
-		auto pos = dynamic_cast<PositionComponent *>(&m_entity->getComponent("Pos"));
+		auto pos = m_entity->get<PositionComponent>();
+
+		//Fail if the nearest player has been knocked out since we last checked
+		auto nearestPlayer = comp->nearest();
+		if (nullptr == nearestPlayer)
+			return false;
 
 		//Cast nearest player entity from Ai component to Position component
-		auto nearest = dynamic_cast<PositionComponent *>(&comp->nearestPlayer->getComponent("Pos"));
+		auto nearest = nearestPlayer->get<PositionComponent>();
 
 		//Check if the nearest player is to the left of AI
 		if (nearest->position.x < pos->position.x)
@@ -342,7 +352,7 @@ public:
 	/// <returns></returns>
 	bool run() override
 	{
-		auto p = dynamic_cast<PlayerPhysicsComponent *>(&m_entity->getComponent("Player Physics"));
+		auto p = m_entity->get<PlayerPhysicsComponent>();
 		return p->damagePercentage() > 50 ? true : false;
 	}
 };
@@ -363,13 +373,18 @@ public:
 	bool run() override
 	{
 		//Get AI component
-		auto comp = dynamic_cast<AIComponent *>(&m_entity->getComponent("AI"));
+		auto comp = m_entity->get<AIComponent>();
 
 		//Cast self component to PositionComponent
-		auto pos = dynamic_cast<PositionComponent *>(&m_entity->getComponent("Pos"));
+		auto pos = m_entity->get<PositionComponent>();
+
+		//Fail if the nearest player has been knocked out since we last checked
+		auto nearestPlayer = comp->nearest();
+		if (nullptr == nearestPlayer)
+			return false;
 
 		//Cast nearest player entity from Ai component to Position component
-		auto nearest = dynamic_cast<PositionComponent *>(&comp->nearestPlayer->getComponent("Pos"));
+		auto nearest = nearestPlayer->get<PositionComponent>();
 
 		//While the distance to the nearest enemy is less than 200
 		if (dist(pos->position, nearest->position) < 200)
@@ -409,13 +424,18 @@ public:
 	bool run() override
 	{
 		//Get AI component
-		auto comp = dynamic_cast<AIComponent *>(&m_entity->getComponent("AI"));
+		auto comp = m_entity->get<AIComponent>();
 
 		//Cast self component to PositionComponent
-		auto pos = dynamic_cast<PositionComponent *>(&m_entity->getComponent("Pos"));
+		auto pos = m_entity->get<PositionComponent>();
+
+		//Fail if the nearest player has been knocked out since we last checked
+		auto nearestPlayer = comp->nearest();
+		if (nullptr == nearestPlayer)
+			return false;
 
 		//Cast nearest player entity from Ai component to Position component
-		auto nearest = dynamic_cast<PositionComponent *>(&comp->nearestPlayer->getComponent("Pos"));
+		auto nearest = nearestPlayer->get<PositionComponent>();
 
 		if (nearest->position.y < pos->position.y - 100)
 		{
@@ -465,10 +485,15 @@ public:
 	bool run() override
 	{
 		//Get AI component
-		auto comp = dynamic_cast<AIComponent *>(&m_entity->getComponent("AI"));
+		auto comp = m_entity->get<AIComponent>();
+
+		//Fail if the nearest player has been knocked out since we last checked
+		auto nearestPlayer = comp->nearest();
+		if (nullptr == nearestPlayer)
+			return false;
 
 		//Cast nearest player entity from Ai component to Position component
-		auto nearest = dynamic_cast<PlayerPhysicsComponent *>(&comp->nearestPlayer->getComponent("Player Physics"));
+		auto nearest = nearestPlayer->get<PlayerPhysicsComponent>();
 
 		//Return true if nearest players damage % is greater than 50
 		return nearest->damagePercentage() > 50 ? true : false;
@@ -508,10 +533,10 @@ public:
 
 	bool run() override
 	{
-		auto acomp = static_cast<AIComponent *>(&m_entity->getComponent("AI"));
-		auto p = static_cast<PlayerComponent *>(&m_entity->getComponent("Player"));
-		auto pos = static_cast<PositionComponent *>(&m_entity->getComponent("Pos"));
-		auto phys = static_cast<PlayerPhysicsComponent *>(&m_entity->getComponent("Player Physics"));
+		auto acomp = m_entity->get<AIComponent>();
+		auto p = m_entity->get<PlayerComponent>();
+		auto pos = m_entity->get<PositionComponent>();
+		auto phys = m_entity->get<PlayerPhysicsComponent>();
 		int index = random(1, 3);
 		Vector2f positionOne = Vector2f(1355, 80);
 		Vector2f positionTwo = Vector2f(1035, 80);
@@ -522,13 +547,13 @@ public:
 			switch (index)
 			{
 			case 1:
-				phys->posPtr->position = positionOne;
+				pos->position = positionOne;
 				break;
 			case 2:
-				phys->posPtr->position = positionTwo;
+				pos->position = positionTwo;
 				break;
 			case 3:
-				phys->posPtr->position = positionThree;
+				pos->position = positionThree;
 				break;
 			}
 
@@ -548,8 +573,7 @@ public:
 
 	int random(int min, int max)
 	{
-		double x = rand() / static_cast<double>(RAND_MAX + 1);
-		int val = min + static_cast<int>(x * (max - min));
+		int val = min + static_cast<int>(m_entity->get<PlayerComponent>()->random().real() * (max - min));
 		return val;
 	}
 };
@@ -569,13 +593,18 @@ public:
 	bool run() override
 	{
 		//Get AI component
-		auto comp = dynamic_cast<AIComponent *>(&m_entity->getComponent("AI"));
+		auto comp = m_entity->get<AIComponent>();
 		//Cast self component to PositionComponent
-		auto pos = dynamic_cast<PositionComponent *>(&m_entity->getComponent("Pos"));
+		auto pos = m_entity->get<PositionComponent>();
+		//Fail if the nearest player has been knocked out since we last checked
+		auto nearestPlayer = comp->nearest();
+		if (nullptr == nearestPlayer)
+			return false;
+
 		//Cast nearest player entity from Ai component to Position component
-		auto nearest = dynamic_cast<PositionComponent *>(&comp->nearestPlayer->getComponent("Pos"));
+		auto nearest = nearestPlayer->get<PositionComponent>();
 
-		auto phys = static_cast<PlayerPhysicsComponent *>(&m_entity->getComponent("Player Physics"));
+		auto phys = m_entity->get<PlayerPhysicsComponent>();
 
 		//If the AI is more than 50 pixels from the player
 		//dist(nearest->position, pos->position) > 50
@@ -15,6 +15,11 @@ public:
 	{
 	}
 
+	void handleInput(Entity* e) override
+	{
+		handleInput("", e);
+	}
+
 	void handleInput(std::string s, Entity * e)
 	{
 		m_currentCMD = nullptr;
@@ -53,10 +58,10 @@ public:
 		{
 			m_currentCMD->execute(*e);
 		} //Otherwise execute the idle command
-		else if (static_cast<AttackComponent *>(&e->getComponent("Attack"))->attackActive() == false
-			&& !(static_cast<AnimationComponent *>(&e->getComponent("Animation"))->getCurrentID() == "Jump"
-				&& static_cast<AnimationComponent *>(&e->getComponent("Animation"))->getCurrentAnimation()->getCompleted() == false)
-			&& static_cast<PlayerPhysicsComponent *>(&e->getComponent("Player Physics"))->stunned() == false)
+		else if (e->get<AttackComponent>()->attackActive() == false
+			&& !(e->get<AnimationComponent>()->getCurrentID() == "Jump"
+				&& e->get<AnimationComponent>()->getCurrentAnimation()->getCompleted() == false)
+			&& e->get<PlayerPhysicsComponent>()->stunned() == false)
 		{
 			m_idleCMD.execute(*e);
 		}
@@ -3,6 +3,9 @@
 #define ANIMATIONCOMPONENT_H
 #include "SpriteComponent.h"
 #include "SDL.h"
+#include "TextureRegion.h"
+
+class Entity;
 
 class AnimationComponent : public Component
 {
@@ -12,25 +15,25 @@ public:
 	{
 	public:
 		Animation() {  }
-		Animation(SDL_Texture* texture, std::string name, std::vector<SDL_Rect> frames, int maxFrames, float duration);
+		Animation(TextureRegion texture, std::string name, std::vector<SDL_Rect> frames, int maxFrames, float duration);
 		void setLoop(bool b);
 		void resetAnimation();
 
 		std::string& getName() { return m_name; }
 		SDL_Rect getCurrentTextureRect() { return m_frames.at(m_currentFrame); };
 		SDL_Rect getOverallSize() { return m_overallSize; }
-		SDL_Texture* getTexture() { return m_texture; }
+		TextureRegion getTexture() { return m_texture; }
 		bool& getLoop();
 		bool& getCompleted();
 		int& getCurrentFrame();
 		int& getMaxFrames();
 		float& getTimeGone();
 		float& getTimePerFrame();
-		void setTexture(SDL_Texture* texture) { m_texture = texture; }
+		void setTexture(TextureRegion texture) { m_texture = texture; }
 		std::vector<SDL_Rect> getFrames() { return m_frames; }
 	private:
 		std::string m_name; //Name of the animation
-		SDL_Texture* m_texture; //The texture to animate
+		TextureRegion m_texture; //The texture to animate
 		std::vector<SDL_Rect> m_frames; //Frames of the animation
 		SDL_Rect m_overallSize; //Size of the entire animation
 		int m_currentFrame; //The current frame of the animation
@@ -42,17 +45,20 @@ public:
 		bool m_completed; //Wheter the animation is finished or not
 	};
 
+	//The sprite can be nullptr for an animation kept by the entity manager, it animates its entity's sprite
 	AnimationComponent(Component* sprite);
 
-	void addAnimation(std::string name, SDL_Texture* texture, std::vector<SDL_Rect> frames, float duration);
+	void addAnimation(std::string name, TextureRegion texture, std::vector<SDL_Rect> frames, float duration);
 	void playAnimation(std::string name, bool loop);
+	void setOwner(Entity* owner) { m_ownerPtr = owner; }
 
-	std::string getCurrentID() { return m_current->getName(); }
-	Animation* getCurrentAnimation() { return m_current; }
-	SpriteComponent* getSprite() { return static_cast<SpriteComponent*>(m_spriteToAnimate); }
+	std::string getCurrentID() { return getCurrentAnimation()->getName(); }
+	Animation* getCurrentAnimation() { return m_current < 0 ? nullptr : &m_animations[m_current]; }
+	SpriteComponent* getSprite();
 private:
 	Component * m_spriteToAnimate;
-	Animation* m_current;
-	std::map<std::string, Animation> m_animations; //Map of animations
+	Entity* m_ownerPtr;
+	int m_current; //Index of the animation playing, -1 if none. An index so the component can be copied and moved
+	std::vector<Animation> m_animations; //A handful each, looked up by name
 };
 #endif
\ No newline at end of file
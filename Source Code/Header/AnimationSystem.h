@@ -1,12 +1,22 @@
 #pragma once
-#include "System.h"
+#include "TypedSystem.h"
 #include "AnimationComponent.h"
+#include "EntityManager.h"
 
-class AnimationSystem : public System
+//Runs the animations added to it and, while there is a match, the packed animations of the match's entities
+class AnimationSystem : public TypedSystem<AnimationComponent>
 {
 public:
-	AnimationSystem() {};
+	AnimationSystem() : m_entitiesPtr(nullptr) {};
 	void addComponent(Component * comp);
 	void update(double dt);
+	void setEntities(EntityManager* entities) { m_entitiesPtr = entities; } //nullptr when the match is over
+	SystemAccess access() const override
+	{
+		return SystemAccess().write<AnimationComponent>().write<SpriteComponent>();
+	}
 private:
+	void animate(AnimationComponent& comp, double dt);
+
+	EntityManager* m_entitiesPtr;
 };
\ No newline at end of file
@@ -11,6 +11,13 @@ class AttackComponent : public Component
 {
 public:
 	AttackComponent();
+	~AttackComponent();
+
+	//Hitbox sizes of the attacks, the commands attack with these
+	static const Vector2f PUNCH_SIZE, KICK_SIZE, UPPERCUT_SIZE;
+
+	//Makes a switched off hitbox for every attack, call once the player's body is made so it is there for the first attack
+	void createHitboxes(Box2DBridge& world, Entity& e);
 
 	//Spawns an attack positioned at offset with a size of size and it belongs to the entity
 	//and the attack is tagged so we know what it is (punch, kick) and the time to live for that attack
@@ -19,6 +26,7 @@ public:
 	void setAttackProperties(int dmg, float xImpulse, float yImpulse);
 	void spawn(Box2DBridge& world); //Spawns an attack
 	void deleteAttack(Box2DBridge& world); //Deletes the attack
+	void releaseHitboxes(Box2DBridge& world); //Destroys the hitbox bodies, for when the player leaves the match
 	void updatePosition();
 
 	//Setters
@@ -39,6 +47,19 @@ public:
 	PhysicsComponent * m_currentAttack; //A pointer to the attack
 	std::string m_currentAttackTag;
 private:
+	//A sensor body for one size of attack, made with the player and then
+	//switched on and off instead of being made and destroyed for every punch
+	struct Hitbox
+	{
+		Vector2f size;
+		std::string tag;
+		PhysicsComponent* physics;
+		PhysicsComponent::ColData* data;
+	};
+
+	PhysicsComponent* hitbox();
+
+	std::vector<Hitbox> m_hitboxes;
 	float m_delay, m_xImpulse, m_yImpulse;
 	int m_dmg;
 	bool m_startDelay, m_attacked, m_delete;
@@ -9,6 +9,11 @@ public:
 	AttackSystem(Box2DBridge& world) :m_worldPtr(&world) { };
 	void addComponent(Component * comp);
 	void update(double dt);
+	SystemAccess access() const override
+	{
+		return SystemAccess().write<AttackComponent>().read<PlayerPhysicsComponent>().read<PositionComponent>()
+			.writeResource(SystemAccess::PHYSICS_WORLD);
+	}
 private:
 	Box2DBridge * m_worldPtr;
 };
\ No newline at end of file
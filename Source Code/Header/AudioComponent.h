@@ -16,17 +16,21 @@ public:
 		std::string& getName() { return m_name; }
 		void setSound(Mix_Chunk* sfx) { m_isSFX = true, m_sfx = sfx; }
 		void setSound(Mix_Music* music) { m_isSFX = false, m_music = music;}
+		//The headless build has no audio device, sounds are kept so the names still work but never play
 		void play(bool loop)
 		{
+#ifndef CYBERPUNCH_HEADLESS
 			if (m_isSFX)
 				Mix_PlayChannel(-1, m_sfx, loop ? -1 : 0);
 			else
 				Mix_PlayMusic(m_music, loop ? -1 : 0);
+#endif
 		}
 
 		void stop() {
-		
+#ifndef CYBERPUNCH_HEADLESS
 			Mix_HaltMusic();
+#endif
 		}
 
 	private:
@@ -6,6 +6,7 @@
 #include <vector>
 #include <string>
 #include <algorithm>
+#include "Random.h"
 
 class BehaviourTree
 {
@@ -16,6 +17,7 @@ public:
 	class Node
 	{
 	public:
+		virtual ~Node() {}
 		virtual bool run() = 0;
 	};
 
@@ -33,7 +35,14 @@ public:
 	private:
 		std::vector<Node *> m_children;
 	protected:
-		std::vector<Node *> childrenShuffled() const { std::vector<Node *> temp = m_children; std::random_shuffle(temp.begin(), temp.end()); return temp; }
+		//Fisher-Yates with our own generator, std::shuffle is free to pick the order differently on each compiler
+		std::vector<Node *> childrenShuffled(Random& random) const
+		{
+			std::vector<Node *> temp = m_children;
+			for (int i = (int)temp.size() - 1; i > 0; i--)
+				std::swap(temp[i], temp[random.range(i + 1)]);
+			return temp;
+		}
 	};
 
 	/// <summary>
@@ -64,10 +73,15 @@ public:
 	class RandomSelector : public CompositeNode
 	{
 	public:
+		RandomSelector() : m_randomPtr(nullptr) {}
+
+		//The generator the children are shuffled with, it has to be set before the node is run
+		void setRandom(Random* random) { m_randomPtr = random; }
+
 		virtual bool run() override
 		{
 			//Order of child nodes is randomised
-			for (Node * c : childrenShuffled())
+			for (Node * c : childrenShuffled(*m_randomPtr))
 			{
 				if (c->run())
 				{
@@ -76,6 +90,8 @@ public:
 			}
 			return false;
 		}
+	private:
+		Random* m_randomPtr;
 	};
 
 	/// <summary>
@@ -175,6 +191,9 @@ private:
 	Root * m_root;
 public:
 	BehaviourTree() : m_root(new Root) {}
+	~BehaviourTree() { delete m_root; }
+	BehaviourTree(const BehaviourTree&) = delete;
+	BehaviourTree& operator=(const BehaviourTree&) = delete;
 	void setRootChild(Node * c) const { m_root->setChild(c); }
 	bool run() const { return m_root->run(); }
 };
@@ -0,0 +1,95 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <chrono>
+#include <ctime>
+#include <functional>
+#include <string>
+#include <vector>
+
+//Small benchmark runner modelled on Google Benchmark so it builds with nothing installed.
+//A benchmark times a loop, the runner grows the iteration count until the loop runs for long enough to measure,
+//then repeats it and keeps the results. The JSON it writes has the same layout as Google Benchmark's so its
+//compare.py can diff a run against a saved baseline
+class Benchmark
+{
+public:
+	//Handed to the benchmark, the code inside while (state.running()) is what gets timed
+	class State
+	{
+	public:
+		State(long long iterations, long long arg);
+
+		bool running();
+		//For setup inside the loop that shouldn't count, costs a clock read each so keep it out of tight loops
+		void pauseTiming();
+		void resumeTiming();
+
+		long long arg() const { return m_arg; }
+		long long iterations() const { return m_iterations; }
+		void setItemsProcessed(long long items) { m_items = items; }
+		void setLabel(const std::string& label) { m_label = label; }
+	private:
+		friend class Benchmark;
+		typedef std::chrono::steady_clock Clock;
+
+		long long m_iterations;
+		long long m_left;
+		long long m_arg;
+		long long m_items;
+		std::string m_label;
+		bool m_started;
+		bool m_paused;
+		Clock::time_point m_start;
+		std::clock_t m_cpuStart;
+		double m_realSeconds;
+		double m_cpuSeconds;
+	};
+
+	typedef std::function<void(State&)> Function;
+
+	//Adds a benchmark, with args it runs once per arg and the arg is added to the name like name/64
+	static void add(const std::string& name, Function function, std::vector<long long> args = {});
+
+	//Runs every benchmark matching the filter. Takes the same flags as Google Benchmark:
+	//--benchmark_filter=regex --benchmark_min_time=seconds --benchmark_repetitions=n
+	//--benchmark_format=console|json --benchmark_out=path (always json)
+	static int main(int argc, char* argv[]);
+
+	//Stops the compiler throwing away a result that is never used
+	template<typename T>
+	static void doNotOptimize(const T& value)
+	{
+#if defined(__GNUC__)
+		asm volatile("" : : "r,m"(value) : "memory");
+#else
+		s_sink = &reinterpret_cast<const volatile char&>(value);
+#endif
+	}
+private:
+	struct Entry
+	{
+		std::string name;
+		Function function;
+		long long arg;
+	};
+
+	struct Result
+	{
+		std::string name;
+		std::string runName;
+		int repetition;
+		long long iterations;
+		double realTime; //Nanoseconds per iteration
+		double cpuTime;
+		double itemsPerSecond; //0 if the benchmark didn't set the items
+		std::string label;
+	};
+
+	static std::vector<Entry>& entries();
+	static Result run(const Entry& entry, double minTime);
+
+	static const volatile char* volatile s_sink;
+};
+
+#endif
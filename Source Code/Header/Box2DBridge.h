@@ -25,7 +25,8 @@ private:
 	const float CONVERSION = 30.0f; //Pixels to world and backwords, we multiply or divide by 30
 };
 
-//Bridge class to allow for easy manipulation of the Box2d API
+//Bridge class to allow for easy manipulation of the Box2d API.
+//The bridge owns the bodies it makes and the ColData given to their fixtures, they are deleted with the body or the world
 class Box2DBridge
 {
 public:
@@ -35,20 +36,31 @@ public:
 	void update(double dt);
 	void flipGravity();
 	void addContactListener(CollisionListener& colListener);
-	void deleteBody(Box2DBody* body);
+	void deleteBody(Box2DBody* body); //Destroyed at the start of the next update, outside of the step
+	void destroyBody(Box2DBody& body); //Destroyed now, only call this outside of the step
 	void deleteWorld();
 
 	//Creates and returns a box2d body, we can create circles and squares
 	Box2DBody* createBox(int posX, int posY, int width, int height, bool canRotate, bool allowSleep, b2BodyType type);
 	Box2DBody* createCircle(int posX, int posY, float radius, bool canRotate, bool allowSleep, b2BodyType type);
 
-	//Allows to modify the mass, friction and sensor boolean on a body
+	//Allows to modify the mass, friction and sensor boolean on a body, data is the body's ColData
 	void addProperties(Box2DBody& body, float mass, float friction, float rest, bool isSensor, void* data);
 
+	//Adds a sensor fixture to a body, offset from its centre, sizes are in pixels. Adds no mass to the body
+	//Call after addProperties, as that changes the first fixture in the body's list
+	b2Fixture* addSensor(Box2DBody& body, float offsetX, float offsetY, int width, int height, void* data);
+
+	//Solves the world's islands on the pool's threads, nullptr to solve them one after another again. Call after initWorld
+	void setTaskPool(b2TaskPool* pool);
+
 	b2World& getWorld() { return *m_world; }
 
 private:
+	void destroyFixtureData(b2Body* body);
+
 	bool m_gravFlipped;
+	std::vector<Box2DBody*> m_bodies; //Every body made since initWorld, kept until the world goes so components can hold them
 	std::vector<Box2DBody*> m_bodiesToDelete;
 	b2World* m_world; //Create this to handle physics simulation
 	const int32 VELOCITY_ITERS = 8; //how strongly to correct velocity
@@ -56,6 +68,7 @@ private:
 	const float CONVERSION = 30.0f; //Pixels to world and backwords, we multiply or divide by 30
 	const b2Vec2 GRAVITY = b2Vec2(0, 20); //Const gravity
 	const b2Vec2 FLIPPEDGRAVITY = b2Vec2(0, -20); //Const flipped gravity
-	double m_secondsPerFrame = 1/60;
-	double m_timeSinceLastFrame = 0;
+	const double m_secondsPerFrame = 1.0 / 120.0; //Fixed length of every world step
+	const int MAX_STEPS = 4; //Most steps one update can take, time past that is dropped so a stall can't snowball
+	double m_timeSinceLastFrame = 0; //Time not stepped yet
 };
\ No newline at end of file
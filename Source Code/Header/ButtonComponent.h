@@ -1,11 +1,12 @@
 #pragma once
 #include "Component.h"
 #include "SDL.h"
+#include "TextureRegion.h"
 
 class ButtonComponent : public Component
 {
 public:
-	ButtonComponent(SDL_Texture* selectedTexture, SDL_Texture* unselectedTexture, std::string tag, bool selected = false) :
+	ButtonComponent(TextureRegion selectedTexture, TextureRegion unselectedTexture, std::string tag, bool selected = false) :
 		m_tag(tag),
 		m_selected(selected),
 		m_selectedTexture(selectedTexture),
@@ -25,10 +26,10 @@ public:
 		m_currentTexture = m_deselectTexture;
 	}
 
-	SDL_Texture* getTexture() { return m_currentTexture; }
+	TextureRegion getTexture() { return m_currentTexture; }
 	std::string& getTag() { return m_tag; }
 private:
 	std::string m_tag;
 	bool m_selected;
-	SDL_Texture * m_selectedTexture, *m_deselectTexture, *m_currentTexture;
+	TextureRegion m_selectedTexture, m_deselectTexture, m_currentTexture;
 };
\ No newline at end of file
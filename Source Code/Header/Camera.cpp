@@ -11,29 +11,40 @@ Camera::Camera(bool use) :
 	m_view.y = 0;
 	m_view.w = SCREEN_WIDTH;
 	m_view.h = SCREEN_HEIGHT;
+
+	m_previousX = 0;
+	m_previousY = 0;
+	m_previousScalar = m_scalar;
+	m_blend = 1;
 }
 
 void Camera::update(double dt)
 {
 	if (m_scalar != m_desiredScalar)
 	{
-		if (m_desiredScalar > m_scalar)
-		{
-			m_scalar += .0002 * dt;
-		}
-		else
-		{
-			m_scalar -= .0002 * dt;
-		}
+		//Ease towards the zoom we want, a bigger gap moves faster
+		auto step = ZOOM_SPEED * dt;
+		if (step > 1)
+			step = 1;
+		m_scalar += (m_desiredScalar - m_scalar) * step;
 
+		//Snap once we are close enough that the difference can't be seen
 		if ((m_scalar - m_desiredScalar) > -0.005
-			|| (m_scalar - m_desiredScalar) < 0.005)
+			&& (m_scalar - m_desiredScalar) < 0.005)
 		{
 			m_scalar = m_desiredScalar;
 		}
 	}
 }
 
+//Keeps the view as it is before a fixed step moves it, so the draw can blend from it
+void Camera::beginStep()
+{
+	m_previousX = m_view.x;
+	m_previousY = m_view.y;
+	m_previousScalar = m_scalar;
+}
+
 void Camera::centerCamera(float x, float y)
 {
 	m_centerPoint.x = x;
@@ -61,10 +72,18 @@ void Camera::setZoom(SDL_Renderer * renderer)
 {
 	if (m_useCamera)
 	{
-		SDL_RenderSetScale(renderer, m_scalar, m_scalar);
+		SDL_RenderSetScale(renderer, getScale(), getScale());
+		updateView();
+	}
+}
 
-		m_view.w = SCREEN_WIDTH / m_scalar;
-		m_view.h = SCREEN_HEIGHT / m_scalar;
+//Works out how much of the world fits on screen at the current zoom
+void Camera::updateView()
+{
+	if (m_useCamera)
+	{
+		m_view.w = SCREEN_WIDTH / getScale();
+		m_view.h = SCREEN_HEIGHT / getScale();
 	}
 }
 
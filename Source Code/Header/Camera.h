@@ -12,18 +12,26 @@ public:
 	void centerCamera(Vector2f pos);
 	void zoom(float scalar);
 	void setZoom(SDL_Renderer* renderer);
+	void updateView();
+	void beginStep();
+	void setBlend(float alpha) { m_blend = alpha; }
 	void setActive(bool b) { m_useCamera = b; }
+	bool isActive() { return m_useCamera; }
 
-	float x() { return m_useCamera ? m_view.x : 0; }
-	float y() { return m_useCamera ? m_view.y : 0; }
-	float getScale() { return m_scalar; }
+	//Blended between the last two fixed steps, the same way the sprites are
+	float x() { return m_useCamera ? blend(m_previousX, m_view.x) : 0; }
+	float y() { return m_useCamera ? blend(m_previousY, m_view.y) : 0; }
+	float getScale() { return blend(m_previousScalar, m_scalar); }
+	SDL_Rect visibleArea() { return { (int)x(), (int)y(), m_view.w, m_view.h }; } //The part of the world on screen, before the zoom is applied
 
 	const float MAX_ZOOM = 1.55f;
 	const float MIN_ZOOM = 1.0f;
+	const float ZOOM_SPEED = 4.0f; //How quickly the zoom closes the gap to the zoom it wants, per second
 	float& scalar() { return m_scalar; }
 	SDL_Rect m_view;
 private:
 	void center();
+	float blend(float from, float to) { return from + (to - from) * m_blend; }
 
 	Vector2f m_centerPoint;
 
@@ -36,4 +44,8 @@ private:
 	float m_scalar;
 	float m_desiredScalar;
 	bool m_useCamera;
+
+	//The view before the last step and how far the frame is towards the current one
+	float m_previousX, m_previousY, m_previousScalar;
+	float m_blend;
 };
\ No newline at end of file
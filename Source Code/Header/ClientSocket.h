@@ -4,7 +4,9 @@
 #include <iostream>
 #include <string>
 #include <sstream>
+#ifdef _WIN32
 #include <conio.h>           // Needed for kbhit and getch
+#endif
 #include <string.h>
 #include <nlohmann/json.hpp>
 #include <iterator>
@@ -56,8 +58,8 @@ class ClientSocket
 		// Function to poll for clients connecting
 		void connectToServer();
 
-		// Function to check the server for incoming messages
-		string checkForIncomingMessages();
+		// Function to check the server for incoming messages, waiting up to waitMs for one to arrive (0 just checks)
+		string checkForIncomingMessages(unsigned int waitMs = SOCKET_SET_POLL_PERIOD);
 
 		// Function to display a received message
 		void displayMessage(string &receivedMessage);
@@ -0,0 +1,58 @@
+#ifndef COLLISIONCATEGORY_H
+#define COLLISIONCATEGORY_H
+
+#include <Box2D/Box2D.h>
+#include <string>
+
+//What a fixture is for the collision listener, worked out once from its tag when the fixture is made.
+//Each type is one bit in the fixture's b2Filter. OTHER is bit 0, Box2D's default, so untagged fixtures are OTHER
+struct CollisionCategory
+{
+	enum Type
+	{
+		OTHER,
+		PLAYER_BODY,
+		JUMP_SENSOR,
+		PLATFORM,
+		FLOOR,
+		SCENERY, //Level geometry players stand on or bump into that nothing reacts to (walls, the booth stands)
+		ATTACK,
+		BOOTH,
+		KILL_BOX,
+		PICKUP,
+		LEFT_EDGE_SENSOR,
+		RIGHT_EDGE_SENSOR,
+		COUNT
+	};
+
+	static uint16 bit(Type type) { return uint16(1 << type); }
+
+	static Type fromTag(const std::string& tag)
+	{
+		if (tag == "Player Body")
+			return PLAYER_BODY;
+		if (tag == "Jump Sensor")
+			return JUMP_SENSOR;
+		if (tag == "Platform")
+			return PLATFORM;
+		if (tag == "Floor")
+			return FLOOR;
+		if (tag == "Wall" || tag == "DJ-Booth")
+			return SCENERY;
+		if (tag == "Attack")
+			return ATTACK;
+		if (tag == "Booth")
+			return BOOTH;
+		if (tag == "Kill Box")
+			return KILL_BOX;
+		if (tag == "Pickup")
+			return PICKUP;
+		if (tag == "Left Edge Sensor")
+			return LEFT_EDGE_SENSOR;
+		if (tag == "Right Edge Sensor")
+			return RIGHT_EDGE_SENSOR;
+		return OTHER;
+	}
+};
+
+#endif
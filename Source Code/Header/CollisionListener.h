@@ -1,24 +1,78 @@
 #pragma once
 #include "Box2D/Box2D.h"
+#include "CollisionCategory.h"
 #include "Observer.h"
 #include <string>
 #include <iostream>
 
 //Class listens for collisions, this is an observer class
-//From here we can check if specific sensor have collided
+//From here we can check if specific sensor have collided.
+//Every fixture has a collision category, the pair of categories picks the handler out of a table so a contact
+//costs the same however many kinds of collision there are. Pairs with no handler that don't need to push
+//each other apart are filtered out by Box2D and never become contacts
 class CollisionListener : public b2ContactListener, public Subject
 {
 public:
-	CollisionListener() : 
+	CollisionListener() :
 		m_gravFlipped(false)
 	{}
 
 	void BeginContact(b2Contact* contact);
 	void EndContact(b2Contact* contact);
-	void checkPlayerAttack(b2Contact* contact);
 	void PreSolve(b2Contact* contact, const b2Manifold* oldManifold);
 	void PostSolve(b2Contact* contact, const b2ContactImpulse* impulse);
 	void flipGravity();
+
+	//Filter for a fixture with this ColData as its user data, it only collides with the categories it has a use for
+	static b2Filter filter(void* userData);
 private:
+	//Gets the fixtures in the order the categories were given when the handler was added
+	typedef void (CollisionListener::*Handler)(b2Contact* contact, b2Fixture* a, b2Fixture* b);
+
+	struct Entry
+	{
+		Handler handler;
+		bool swap; //The contact has the fixtures the other way round to the handler
+	};
+
+	//A handler for every pair of categories, empty where nothing happens
+	struct Table
+	{
+		Table();
+		Entry entries[CollisionCategory::COUNT][CollisionCategory::COUNT];
+	};
+
+	struct Handlers
+	{
+		Handlers();
+		void add(Table& table, CollisionCategory::Type a, CollisionCategory::Type b, Handler handler);
+		void collide(CollisionCategory::Type a, CollisionCategory::Type b); //Lets the pair touch without a handler
+
+		Table begin, end, preSolve;
+		uint16 masks[CollisionCategory::COUNT];
+	};
+
+	static const Handlers& handlers();
+	void dispatch(const Table& table, b2Contact* contact);
+
+	//Begin contact
+	void landOnPlatform(b2Contact* contact, b2Fixture* sensor, b2Fixture* platform);
+	void landOnFloor(b2Contact* contact, b2Fixture* sensor, b2Fixture* floor);
+	void landOnPlayer(b2Contact* contact, b2Fixture* sensor, b2Fixture* body);
+	void collectPickUp(b2Contact* contact, b2Fixture* body, b2Fixture* pickUp);
+	void hitBooth(b2Contact* contact, b2Fixture* attack, b2Fixture* booth);
+	void enterKillBox(b2Contact* contact, b2Fixture* killBox, b2Fixture* body);
+	void hitPlayer(b2Contact* contact, b2Fixture* attack, b2Fixture* body);
+
+	//End contact
+	void leaveGround(b2Contact* contact, b2Fixture* sensor, b2Fixture* ground);
+	void leavePlayer(b2Contact* contact, b2Fixture* sensor, b2Fixture* body);
+	void leaveRightEdge(b2Contact* contact, b2Fixture* sensor, b2Fixture* ground);
+	void leaveLeftEdge(b2Contact* contact, b2Fixture* sensor, b2Fixture* ground);
+	void leavePlatform(b2Contact* contact, b2Fixture* body, b2Fixture* platform);
+
+	//Pre solve
+	void passThroughPlatform(b2Contact* contact, b2Fixture* body, b2Fixture* platform);
+
 	bool m_gravFlipped;
-};
\ No newline at end of file
+};
@@ -1,8 +1,12 @@
 #ifndef COMPONENT_H
 #define COMPONENT_H
 
+#include <cstdlib>
+#include <iostream>
 #include <vector>
 #include <map>
+#include "ComponentPool.h"
+#include "TypeId.h"
 
 class Component
 {
@@ -13,4 +17,30 @@ public:
 	std::string m_ID;
 };
 
-#endif
\ No newline at end of file
+//Gives every component class its own index, used by the entity to find the component in an array instead of a string map
+//and by the systems to say which components they use. Both are sized by MAX_TYPES
+class ComponentType : public TypeId<Component>
+{
+public:
+	static const int MAX_TYPES = 32; //Max amount of different component classes
+
+	//Checked in release builds too, one class too many would otherwise write past every entity's typed slots
+	template<typename T>
+	static int id()
+	{
+		static const int typeId = checked(TypeId<Component>::id<T>());
+		return typeId;
+	}
+private:
+	static int checked(int id)
+	{
+		if (id >= MAX_TYPES)
+		{
+			std::cerr << "More than " << MAX_TYPES << " component classes, raise ComponentType::MAX_TYPES" << std::endl;
+			std::abort();
+		}
+		return id;
+	}
+};
+
+#endif
@@ -0,0 +1,96 @@
+#ifndef COMPONENTPOOL_H
+#define COMPONENTPOOL_H
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+//Packs every component of one type into large chunks so systems walking them touch contiguous memory.
+//Slots never move once handed out, components keep pointers to each other (sprite to position etc.)
+//so a freed slot goes onto a free list and is reused by the next component of that type
+template<typename T, std::size_t ChunkSize = 256>
+class ComponentPool
+{
+public:
+	static ComponentPool& instance()
+	{
+		static ComponentPool pool;
+		return pool;
+	}
+
+	void* allocate()
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		//Grab a new chunk if every slot is in use
+		if (m_free.empty())
+		{
+			m_chunks.emplace_back(new Slot[ChunkSize]);
+			auto chunk = m_chunks.back().get();
+
+			//Push in reverse so the chunk gets filled front to back
+			for (std::size_t i = ChunkSize; i > 0; i--)
+				m_free.push_back(&chunk[i - 1]);
+		}
+
+		auto slot = m_free.back();
+		m_free.pop_back();
+		m_live++;
+		return slot;
+	}
+
+	void deallocate(void* ptr)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_free.push_back(static_cast<Slot*>(ptr));
+		m_live--;
+	}
+
+	std::size_t size() const { return m_live; }
+	std::size_t capacity() const { return m_chunks.size() * ChunkSize; }
+private:
+	ComponentPool() : m_live(0) {}
+	ComponentPool(const ComponentPool&) = delete;
+	ComponentPool& operator=(const ComponentPool&) = delete;
+
+	//Raw storage for one component, constructed in place by the component's operator new
+	struct Slot
+	{
+		typename std::aligned_storage<sizeof(T), alignof(T)>::type data;
+	};
+
+	std::vector<std::unique_ptr<Slot[]>> m_chunks; //Chunks are never freed while the game is running
+	std::vector<Slot*> m_free; //Slots ready to be reused
+	std::size_t m_live; //Amount of components currently allocated
+	std::mutex m_mutex;
+};
+
+//Inherit from this to have new and delete of a component go through its pool, eg. class PhysicsComponent : public Component, public Pooled<PhysicsComponent>.
+//Positions, sprites and animations aren't pooled, a match keeps them packed in its entity manager (see ComponentStorage)
+//Classes deriving from a pooled component are a different size so they fall back to the normal heap
+template<typename T>
+class Pooled
+{
+public:
+	static void* operator new(std::size_t size)
+	{
+		if (size != sizeof(T))
+			return ::operator new(size);
+		return ComponentPool<T>::instance().allocate();
+	}
+
+	static void operator delete(void* ptr, std::size_t size)
+	{
+		if (nullptr == ptr)
+			return;
+		if (size != sizeof(T))
+			::operator delete(ptr);
+		else
+			ComponentPool<T>::instance().deallocate(ptr);
+	}
+};
+
+#endif
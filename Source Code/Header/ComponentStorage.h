@@ -0,0 +1,95 @@
+#ifndef COMPONENTSTORAGE_H
+#define COMPONENTSTORAGE_H
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "EntityHandle.h"
+
+//Keeps every component of one type by value in a single packed array so a system can walk them front to back.
+//The sparse array goes from an entity's slot index to where its component is in the packed array.
+//Removing swaps the last component into the hole, so a component moves when another is removed and all of them
+//can move when one is added. Don't hold on to a pointer into the storage past the next add or remove
+template<typename T>
+class ComponentStorage
+{
+public:
+	static const uint32_t NONE = ~0u;
+
+	//Makes the entity's component, replacing the one it has if there is one
+	template<typename... Args>
+	T& add(EntityHandle owner, Args&&... args)
+	{
+		auto index = owner.index();
+		if (index >= m_sparse.size())
+			m_sparse.resize(index + 1, NONE);
+
+		if (NONE != m_sparse[index] && m_owners[m_sparse[index]] == owner)
+		{
+			auto& c = m_dense[m_sparse[index]];
+			c = T(std::forward<Args>(args)...);
+			return c;
+		}
+
+		m_sparse[index] = (uint32_t)m_dense.size();
+		m_owners.push_back(owner);
+		m_dense.emplace_back(std::forward<Args>(args)...);
+		return m_dense.back();
+	}
+
+	//Takes the entity's component out, returns where the last component was moved to or NONE if nothing moved
+	uint32_t remove(EntityHandle owner)
+	{
+		if (has(owner) == false)
+			return NONE;
+
+		auto index = m_sparse[owner.index()];
+		auto last = (uint32_t)m_dense.size() - 1;
+		m_sparse[owner.index()] = NONE;
+
+		if (index == last)
+		{
+			m_dense.pop_back();
+			m_owners.pop_back();
+			return NONE;
+		}
+
+		m_dense[index] = std::move(m_dense.back());
+		m_owners[index] = m_owners.back();
+		m_sparse[m_owners[index].index()] = index;
+		m_dense.pop_back();
+		m_owners.pop_back();
+		return index;
+	}
+
+	//The generation has to match too, a handle to a destroyed entity doesn't find the component of whatever reused the slot
+	bool has(EntityHandle owner) const
+	{
+		auto index = owner.index();
+		return index < m_sparse.size() && NONE != m_sparse[index] && m_owners[m_sparse[index]] == owner;
+	}
+	T* get(EntityHandle owner) { return has(owner) ? &m_dense[m_sparse[owner.index()]] : nullptr; }
+
+	void clear()
+	{
+		m_dense.clear();
+		m_owners.clear();
+		m_sparse.clear();
+	}
+
+	size_t size() const { return m_dense.size(); }
+	T* data() { return m_dense.data(); }
+	T& operator[](size_t i) { return m_dense[i]; }
+	EntityHandle owner(size_t i) const { return m_owners[i]; }
+	typename std::vector<T>::iterator begin() { return m_dense.begin(); }
+	typename std::vector<T>::iterator end() { return m_dense.end(); }
+private:
+	std::vector<T> m_dense; //The components, packed
+	std::vector<EntityHandle> m_owners; //The entity of each packed component
+	std::vector<uint32_t> m_sparse; //Packed index by entity slot index, NONE if the entity has none
+};
+
+template<typename T>
+const uint32_t ComponentStorage<T>::NONE;
+
+#endif
@@ -0,0 +1,16 @@
+#ifndef CONTROLCOMPONENT_H
+#define CONTROLCOMPONENT_H
+
+#include "Component.h"
+
+class Entity;
+
+//Whatever drives a player each tick, a pad, a bot or commands sent over the network.
+//Players keep theirs in the ControlComponent slot, so the scenes tick it without knowing which kind it is
+class ControlComponent : public Component
+{
+public:
+	virtual void handleInput(Entity* e) = 0;
+};
+
+#endif
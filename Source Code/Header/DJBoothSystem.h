@@ -1,13 +1,18 @@
 #ifndef  DJBOOTHSYSTEM_H
 #define DJBOOTHSYSTEM_H
 
-#include "System.h"
+#include "TypedSystem.h"
+#include "DJboothComponent.h"
 #include "PickUpComponent.h"
 #include "ResourceManager.h"
 #include "Entity.h"
 #include "AudioComponent.h"
 
-class DJBoothSystem : public System
+class SlowBoothComponent;
+class SpriteComponent;
+class PositionComponent;
+
+class DJBoothSystem : public TypedSystem<DJBoothComponent>
 {
 public:
 	DJBoothSystem(ResourceHandler* Res, std::vector<Entity*>* platforms, Entity* bg,
@@ -18,12 +23,19 @@ public:
 		m_platformsPtr(platforms),
 		m_currentBg(0),
 		m_currentPc(0),
-		m_currentTrack(0)
+		m_currentTrack(0),
+		m_slowBooth(nullptr)
 	{}
 		
 	void addComponent(Component* comp);
+	void removeAllComponents() override;
 	void update(double dt);
 	float getScalar();
+	SystemAccess access() const override
+	{
+		return SystemAccess().write<DJBoothComponent>().write<SpriteComponent>().write<PositionComponent>().write<PickUpComponent>()
+			.writeResource(SystemAccess::PHYSICS_WORLD | SystemAccess::AUDIO);
+	}
 private:
 	AudioComponent * m_audioPtr;
 	ResourceHandler* m_resourcePtr;
@@ -33,6 +45,7 @@ private:
 	int m_currentPc;
 	int m_currentTrack;
 	Entity* m_pcPtr;
+	SlowBoothComponent* m_slowBooth; //Found once when the booths are added so getScalar doesnt have to search
 };
 
 #endif // !  DJBOOTHSYSTEM_H
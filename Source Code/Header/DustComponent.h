@@ -1,7 +1,7 @@
 #pragma once
 #include "Component.h"
 
-class DustComponent : public Component
+class DustComponent : public Component, public Pooled<DustComponent>
 {
 public:
 	DustComponent() :
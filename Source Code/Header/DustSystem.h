@@ -1,24 +1,39 @@
 #pragma once
 #include "System.h"
-#include "Entity.h"
+#include "EntityCommandBuffer.h"
 #include "DustComponent.h"
 #include "DustTriggerComponent.h"
 #include "ResourceManager.h"
 
+class PlayerPhysicsComponent;
+
 class DustSystem : public System
 {
 public:
-	DustSystem(std::map<std::string, System*>* systems, std::vector<Entity*>* players, ResourceHandler* rH);
+	//The dust is drawn and animated straight out of the entity manager, it isn't added to any system
+	DustSystem(std::vector<Entity*>* players, ResourceHandler* rH, EntityCommandBuffer* commands);
 	void addComponent(Component* c);
 	void update(double dt);
+	void removeAllComponents() override;
+	SystemAccess access() const override
+	{
+		return SystemAccess().write<DustTriggerComponent>().write<DustComponent>().read<PlayerPhysicsComponent>()
+			.readResource(SystemAccess::PHYSICS_WORLD).writeResource(SystemAccess::ENTITY_COMMANDS);
+	}
 
 private:
+	//A dust entity and its dust component, the entity itself is only made when the commands are flushed
+	struct Particle
+	{
+		EntityHandle entity;
+		DustComponent* dust;
+	};
+
 	ResourceHandler * m_resourcesPtr;
+	EntityCommandBuffer* m_commandsPtr;
 	std::vector<Entity*>* m_players;
-	std::vector<Entity*> m_dustParticles; //All the dust in the game
-	std::vector<Entity*> m_dustToDelete;
-	//All the systems in the game
-	std::map<std::string, System*>* m_systems;
+	std::vector<Particle> m_dustParticles; //All the dust in the game
+	std::vector<Particle> m_dustToDelete;
 	//Dust particles rectangles
 	std::vector<SDL_Rect> m_dustFrames;
 };
\ No newline at end of file
@@ -1,18 +1,101 @@
 #ifndef ENTITY_H
 #define ENTITY_H
 
+#include <algorithm>
+#include <array>
+#include <vector>
 #include "Component.h"
+#include "EntityHandle.h"
+
 class Entity
 {
 public:
-	Entity(std::string id) : m_ID(id) {};
+	Entity(std::string id) : m_ID(id) { m_typed.fill(nullptr); };
+
+	//Typed component access, these look up an array slot so prefer them in anything that runs every frame
+	template<typename T>
+	T* get() { return static_cast<T*>(m_typed[slot<T>()]); }
+	template<typename T>
+	bool has() { return nullptr != m_typed[slot<T>()]; }
+	template<typename T>
+	void set(T* c) { m_typed[slot<T>()] = c; }
+
+	//String component access, kept so the scenes can keep using names while they are moved over.
+	//The first component of a type added by name also fills the typed slot for that type
+	template<typename T>
+	void addComponent(std::string id, T* c)
+	{
+		auto it = m_components.find(id);
+		auto& typed = m_typed[slot<T>()];
+
+		//Replace the typed slot if it is empty or if it was holding the component we are replacing
+		if (nullptr == typed || (it != m_components.end() && typed == it->second))
+			typed = c;
+
+		m_components[id] = c;
+	}
 	void addComponent(std::string id, Component* c) { m_components[id] = c; }
-	void removeComponent(std::string id) { m_components.erase(id); }
-	Component& getComponent(std::string id) { return *m_components[id]; }
+	void removeComponent(std::string id)
+	{
+		auto it = m_components.find(id);
+		if (it == m_components.end())
+			return;
+
+		//Clear the typed slot if it points at the component being removed
+		for (auto& typed : m_typed)
+		{
+			if (typed == it->second)
+				typed = nullptr;
+		}
+		m_components.erase(it);
+	}
+	Component& getComponent(std::string id)
+	{
+		//Dont use operator[] here, a miss would insert a null entry into the map
+		auto it = m_components.find(id);
+		return *(it != m_components.end() ? it->second : nullptr);
+	}
+
+	//Deletes every component the entity holds, a component added under more than one name is only deleted once.
+	//A component taken off with removeComponent is no longer the entity's to delete
+	void deleteComponents()
+	{
+		std::vector<Component*> owned;
+		for (auto& c : m_components)
+			owned.push_back(c.second);
+		std::sort(owned.begin(), owned.end());
+		owned.erase(std::unique(owned.begin(), owned.end()), owned.end());
+
+		for (auto c : owned)
+			delete c;
+
+		m_components.clear();
+		m_typed.fill(nullptr);
+	}
+
+	//Empties the entity so the entity manager can reuse it, the components are not deleted
+	void reset(std::string id, EntityHandle handle)
+	{
+		m_components.clear();
+		m_typed.fill(nullptr);
+		m_ID = id;
+		m_handle = handle;
+	}
+
+	EntityHandle handle() const { return m_handle; } //Null unless the entity came from an EntityManager
 
 	std::map<std::string, Component*> m_components; //Collection of components
 	std::string m_ID; //ID of the entitiy
 private:
+	EntityHandle m_handle;
+
+	template<typename T>
+	static int slot()
+	{
+		return ComponentType::id<T>(); //Never past MAX_TYPES, ComponentType stops the game first
+	}
+
+	std::array<Component*, ComponentType::MAX_TYPES> m_typed; //Components indexed by their type id
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,75 @@
+#ifndef ENTITYCOMMANDBUFFER_H
+#define ENTITYCOMMANDBUFFER_H
+
+#include <functional>
+#include <vector>
+#include "EntityManager.h"
+#include "System.h"
+
+//Records structural changes made while the systems are updating (creating and destroying entities,
+//adding and removing components from systems) and applies them together at the end of the frame.
+//Nothing is made until the flush, a created entity is only a reserved handle until then.
+//Nothing a system is looping over changes under it, and every system gets one batched add and one batched remove
+class EntityCommandBuffer
+{
+public:
+	EntityCommandBuffer(EntityManager* entities);
+
+	//Reserves a handle for a new entity, the entity is made at the flush with the components attached to it
+	EntityHandle create(std::string id);
+	//Gives the entity a component at the flush, before the components are added to systems. The entity owns it from then on
+	template<typename T>
+	void attach(EntityHandle entity, std::string name, T* comp)
+	{
+		m_attaches.push_back({ entity, comp, [name, comp](Entity& e) { e.addComponent(name, comp); } });
+	}
+	//Gives the entity a copy of a packed component at the flush, along with the attached ones in the order they were recorded
+	template<typename T>
+	void add(EntityHandle entity, const T& value)
+	{
+		auto entities = m_entitiesPtr;
+		m_attaches.push_back({ entity, nullptr, [entities, value](Entity& e) { entities->add<T>(e.handle(), value); } });
+	}
+	//Destroys the entity after the component changes, its components are deleted with it unless they are kept
+	void destroy(EntityHandle handle, bool keepComponents = false);
+	void addComponent(System* system, Component* comp);
+	void removeComponent(System* system, Component* comp);
+
+	void flush(); //The sync point, applies everything recorded since the last flush
+	void clear(); //Throws away everything recorded and deletes the components attached to entities that were never made
+	bool empty() const { return m_creates.empty() && m_attaches.empty() && m_ops.empty() && m_destroys.empty(); }
+private:
+	struct CreateOp
+	{
+		EntityHandle handle;
+		std::string id;
+	};
+
+	struct AttachOp
+	{
+		EntityHandle handle;
+		Component* component; //nullptr for a packed component, the copy is held by add
+		std::function<void(Entity&)> add; //Adds it under its name, filling the typed slot for its type
+	};
+
+	struct ComponentOp
+	{
+		System* system;
+		Component* component;
+		bool add;
+	};
+
+	struct DestroyOp
+	{
+		EntityHandle handle;
+		bool keepComponents;
+	};
+
+	EntityManager* m_entitiesPtr;
+	std::vector<CreateOp> m_creates; //In the order the handles were reserved, the order the manager makes them in
+	std::vector<AttachOp> m_attaches;
+	std::vector<ComponentOp> m_ops; //In the order they were recorded
+	std::vector<DestroyOp> m_destroys;
+};
+
+#endif
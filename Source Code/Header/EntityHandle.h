@@ -0,0 +1,35 @@
+#ifndef ENTITYHANDLE_H
+#define ENTITYHANDLE_H
+
+#include <cstdint>
+
+//A 32 bit reference to an entity made from the slot index in the entity manager and the generation of that slot.
+//When an entity is destroyed its slot generation goes up, so any handle still pointing at it stops resolving
+//instead of pointing at whatever reuses the slot
+class EntityHandle
+{
+public:
+	static const uint32_t INDEX_BITS = 20;
+	static const uint32_t GENERATION_BITS = 12;
+	static const uint32_t INDEX_MASK = (1u << INDEX_BITS) - 1;
+	static const uint32_t GENERATION_MASK = (1u << GENERATION_BITS) - 1;
+
+	EntityHandle() : m_id(0) {} //Null handle, generations start at 1 so this never resolves
+	EntityHandle(uint32_t index, uint32_t generation) :
+		m_id((index & INDEX_MASK) | ((generation & GENERATION_MASK) << INDEX_BITS))
+	{
+	}
+
+	uint32_t index() const { return m_id & INDEX_MASK; }
+	uint32_t generation() const { return (m_id >> INDEX_BITS) & GENERATION_MASK; }
+	uint32_t id() const { return m_id; }
+	bool isNull() const { return m_id == 0; }
+
+	bool operator==(const EntityHandle& other) const { return m_id == other.m_id; }
+	bool operator!=(const EntityHandle& other) const { return m_id != other.m_id; }
+	bool operator<(const EntityHandle& other) const { return m_id < other.m_id; }
+private:
+	uint32_t m_id;
+};
+
+#endif
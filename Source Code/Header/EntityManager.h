@@ -0,0 +1,108 @@
+#ifndef ENTITYMANAGER_H
+#define ENTITYMANAGER_H
+
+#include <deque>
+#include "AnimationComponent.h"
+#include "ComponentStorage.h"
+#include "Entity.h"
+#include "PositionComponent.h"
+#include "SpriteComponent.h"
+
+//Owns entities in reusable slots and hands out handles to them. Systems and components that need to
+//remember another entity should keep its handle and resolve it through get, a destroyed entity resolves to nullptr.
+//An entity owns its components, they are deleted when it is destroyed.
+//Positions, sprites and animations are kept by the manager instead, by value in a packed array per type,
+//and the entity's typed slot points into the array. Add them with add, not addComponent
+class EntityManager
+{
+public:
+	EntityManager() : m_reservedFree(0), m_reservedNew(0) {}
+
+	Entity* create(std::string id); //Stops the game if there are reservations not made yet
+	//Picks the slot for an entity without changing any slots, so it is safe while systems are looking at entities.
+	//The entities are made with create(handle, id) in the order they were reserved, before anything else creates one.
+	//Anything else stops the game rather than give two entities the same slot
+	EntityHandle reserve();
+	Entity* create(EntityHandle reserved, std::string id);
+	void cancelReservations();
+	void destroy(EntityHandle handle, bool keepComponents = false); //Keep the components if something else still deletes them
+	void destroyAll();
+
+	Entity* get(EntityHandle handle);
+	bool valid(EntityHandle handle) const;
+
+	size_t alive() const { return m_slots.size() - m_free.size(); }
+
+	//Gives the entity a packed component, or replaces the one it has. Only while no system is walking that type
+	template<typename T, typename... Args>
+	T& add(EntityHandle handle, Args&&... args)
+	{
+		auto& storage = components<T>();
+		auto first = storage.data();
+		auto& c = storage.add(handle, std::forward<Args>(args)...);
+
+		//Everything moved if the array grew
+		if (storage.data() != first)
+			relink(storage);
+		else
+			m_slots[handle.index()].entity.set<T>(&c);
+		added(m_slots[handle.index()].entity, c);
+		return c;
+	}
+	template<typename T>
+	void remove(EntityHandle handle)
+	{
+		auto& storage = components<T>();
+		if (storage.has(handle) == false)
+			return;
+
+		m_slots[handle.index()].entity.set<T>((T*)nullptr);
+		auto moved = storage.remove(handle);
+		if (ComponentStorage<T>::NONE != moved)
+			m_slots[storage.owner(moved).index()].entity.set(&storage[moved]);
+	}
+
+	//The packed components of a type, for systems to walk
+	template<typename T>
+	ComponentStorage<T>& components();
+private:
+	EntityManager(const EntityManager&) = delete;
+	EntityManager& operator=(const EntityManager&) = delete;
+
+	//Points every owner's typed slot back at its component
+	template<typename T>
+	void relink(ComponentStorage<T>& storage)
+	{
+		for (size_t i = 0; i < storage.size(); i++)
+			m_slots[storage.owner(i).index()].entity.set(&storage[i]);
+	}
+	template<typename T>
+	void added(Entity& entity, T& c) {}
+	void added(Entity& entity, AnimationComponent& c) { c.setOwner(&entity); } //Finds the sprite through the entity
+	void removePacked(EntityHandle handle);
+
+	struct Slot
+	{
+		Slot() : entity(""), generation(1), alive(false) {}
+		Entity entity;
+		uint32_t generation;
+		bool alive;
+	};
+
+	std::deque<Slot> m_slots; //A deque so entity pointers stay put when more slots are added
+	std::deque<uint32_t> m_free; //Slots ready for reuse, oldest first so a freed slot is not reused straight away
+	size_t m_reservedFree; //Reserved slots taken from the front of m_free
+	uint32_t m_reservedNew; //Reserved slots past the end of m_slots
+	ComponentStorage<PositionComponent> m_positions;
+	ComponentStorage<SpriteComponent> m_sprites;
+	ComponentStorage<AnimationComponent> m_animations;
+};
+
+template<>
+inline ComponentStorage<PositionComponent>& EntityManager::components() { return m_positions; }
+template<>
+inline ComponentStorage<SpriteComponent>& EntityManager::components() { return m_sprites; }
+template<>
+inline ComponentStorage<AnimationComponent>& EntityManager::components() { return m_animations; }
+
+#endif
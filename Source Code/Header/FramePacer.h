@@ -0,0 +1,36 @@
+#ifndef FRAMEPACER_H
+#define FRAMEPACER_H
+
+#include <chrono>
+
+//Holds the main loop to a target frame rate so it doesn't spin a core flat out.
+//Waiting sleeps for most of the frame and spins for the last bit, sleeps can overshoot by a millisecond or so.
+//When vsync is on the present already waits for the display, so the pacer only steps in while the window is in the
+//background, where it drops to a low frame rate
+class FramePacer
+{
+public:
+	typedef std::chrono::steady_clock Clock;
+
+	FramePacer(int targetFps);
+
+	void setTargetFps(int fps);
+	void setVsync(bool vsync) { m_vsync = vsync; }
+	void setFocused(bool focused);
+	bool focused() const { return m_focused; }
+
+	//Call once a frame after presenting, returns when the next frame should start
+	void wait();
+
+	const int BACKGROUND_FPS = 15;
+	const double SPIN_TIME = 0.002; //Seconds before the deadline to stop sleeping and spin instead
+private:
+	double frameTime() const;
+
+	double m_targetFrameTime;
+	bool m_vsync;
+	bool m_focused;
+	Clock::time_point m_deadline; //When the current frame should end
+};
+
+#endif
@@ -26,11 +26,14 @@
 #include "AttackSystem.h"
 #include "PickUpSystem.h"
 #include "OnlineSystem.h"
+#include "ProfilerOverlay.h"
+#include "FramePacer.h"
 
 class Game
 {
 public:
-	Game(int fps);
+	//Vsync is used when the display allows it, otherwise the loop is held to fps
+	Game(int fps, bool vsync = true);
 
 	//Update the game passing in delta time
 	void update(double dt);
@@ -39,6 +42,8 @@ public:
 	void draw();
 
 	void processEvents(SDL_Event& e);
+	//Starts a trace to the file or writes out the one that's running
+	void toggleTrace(const std::string& path);
 
 	void run();
 	//Starts up SDL and creates window
@@ -60,16 +65,30 @@ private:
 	//The renderer, we will use this to draw images
 	SDL_Renderer* m_renderer;
 
-	float m_msPerFrame;
+	bool m_vsync;
 	bool m_quit;
 
+	//Waits out the rest of each frame
+	FramePacer m_pacer;
+
+	//The game is updated in fixed steps, the draw blends between the last two
+	const double STEP_TIME = 1.0 / 120.0;
+	const double MAX_FRAME_TIME = 0.25; //Longer frames (dragging the window, breakpoints) are cut to this
+	const int MAX_STEPS = 8; //Most steps run before a draw, anything left over is dropped
+	double m_stepTime; //Time not stepped yet
+
 	//Our menu manager to handle our scenes
 	MenuManager m_mManager;
 	//Our resource handler
 	ResourceHandler m_resources;
 
-	//Our map of systems
-	std::map<std::string, System*> m_systems;
+	//Our systems, looked up by type
+	SystemRegistry m_systems;
+	InputSystem* m_inputSystem;
+	OnlineSystem* m_onlineSystem;
+
+	//Frame timings, F3 shows them and F4/F5 record a Chrome trace/csv
+	ProfilerOverlay m_profilerOverlay;
 };
 
 #endif
\ No newline at end of file
@@ -1,6 +1,8 @@
 #pragma once
 #include "Scene.h"
-#include "Entity.h"
+#include "EntityCommandBuffer.h"
+#include "MatchBuilder.h"
+#include "SystemScheduler.h"
 #include "AttackSystem.h"
 #include "PreGameScene.h"
 #include "PhysicsSystem.h"
@@ -27,12 +29,16 @@
 #include "OnlineSendComponent.h"
 #include "OnlineInputComponent.h"
 #include "Camera.h"
+#include "Replay.h"
 #include <SDL_net.h>
 
+class RenderSystem;
+class AnimationSystem;
+
 class GameScene : public Scene
 {
 public:
-	GameScene();
+	GameScene(const PreGameScene::PlayersInfo& playerIndexes, AchievementComponent& achievements);
 	void start();
 	void setupTimer();
 	void setupUi();
@@ -41,42 +47,37 @@ public:
 	void updateStartTimer(double dt);
 	void updateEndGameTimer(double dt);
 	void handleAchievementPopup(double dt);
-
-	Entity* createAI(int index, int posX, int posY, bool local, std::vector<Vector2f> spawnPositions);
+	void recordInput();
 
 	void updateCamera(double dt);
-	Entity* createDJB(int index, int posX, int posY);
-
-	void createPlatforms(SDL_Renderer& renderer);
-
-	Entity* createPlayer(int playerNumber, int controllerNumber, int posX, int posY, bool local, std::vector<Vector2f> spawnPositions);
-	Entity* createKillBox(int posX, int posY, int width, int height);
 	
 	void draw(SDL_Renderer& renderer);
 	void handleInput(InputSystem& input);
 private:
 	bool m_audioCreated;
-	bool m_platformsCreated;
 	bool m_boothCreated;
 	bool m_gameStarted, m_startTimerEnded, m_gameOver;
+	EntityManager m_entityManager; //Owns the players, pickup, booths, platforms and ui of a match
+	EntityCommandBuffer m_commands; //Structural changes made during update, applied at the end of it
+	WorkerPool m_workers; //Threads the scheduler hands systems to, the main thread also does work so this is one less than the core count
+	SystemScheduler m_scheduler; //Runs the gameplay systems each update
+	//Systems the match touches every frame, looked up from the registry in start()
+	RenderSystem* m_renderSysPtr;
+	AnimationSystem* m_animationSysPtr;
+	InputSystem* m_inputSysPtr;
+	DJBoothSystem* m_boothSysPtr;
 	Entity m_bgEntity;
 	Entity m_gameStart, m_gameEndE;
 	float m_gameStartTimer, m_endGameTimer;
-	std::vector<Entity*> m_killboxes;
-	std::vector<Entity*> m_localPlayers;
-	std::vector<Entity*> m_AIPlayers;
 	std::vector<Entity*> m_allPlayers; //All local, online and Ai players
 	std::vector<Entity*> m_playersToDel;
-	std::map<Entity*, Entity*> m_ui;
+	std::map<EntityHandle, Entity*> m_ui;
 	Entity m_achiPopup; //Achievement pop up
 	float m_popupTime;
 	bool m_popupHalfPoint, m_popupSet;
 	std::vector<InputSystem*> m_localInputs;
 	int m_numOfLocalPlayers;
-	Entity* m_pickUp;
-	std::vector<Entity*> m_djBooths;
 	//online
-	std::vector<Entity*> m_onlinePlayers;
 	//std::vector<OnlineInputSystem*> m_onlineInputs;
 	int m_numOfOnlinePlayers;
 	int m_numOfAIPlayers;
@@ -92,5 +93,15 @@ private:
 	SDL_Renderer* m_rendererPtr; //Used for resetting the render scale when exiting a game
 	AudioComponent m_audio;
 
+	const PreGameScene::PlayersInfo& m_playerIndexes; //Who is playing, picked in the pre game scene
+	Random m_random; //Everything random in the match draws from this, seeded when the match starts
+	achi::Listener m_events; //The players, booths and collisions of the match send their events here
 	AchievementsListener m_achievListener; //For listening for achievement events, observer pattern
+	AchievementComponent* m_achievementsPtr; //The games achievements, new unlocks pop up during the match
+
+	Replay m_replay; //Every match is recorded and saved when it stops
+	std::vector<Entity*> m_replayPlayers; //Same order as the replay's players, nullptr once they're knocked out
+	const std::string REPLAY_PATH = "last_match.replay";
+
+	MatchBuilder m_builder; //Makes the players, pickup, booths and platforms the same way a headless match does
 };
\ No newline at end of file
@@ -2,24 +2,25 @@
 #include "Box2DBridge.h"
 #include "CollisionListener.h"
 #include "DJboothComponent.h"
-#include "Entity.h"
+#include "EntityManager.h"
 #include "PlayerPhysicsComponent.h"
 #include "PlayerPhysicsSystem.h"
 
 class GravityBoothComponent : public DJBoothComponent
 {
 public: 
-	GravityBoothComponent(std::vector<Entity*> allPlayers, Box2DBridge* world,
+	GravityBoothComponent(const std::vector<Entity*>& allPlayers, EntityManager* entities, Box2DBridge* world,
 		PlayerPhysicsSystem* physSys, CollisionListener* cL, Entity* pickUp) :
 		m_systemPtr(physSys),
-		m_entities(allPlayers),
+		m_entitiesPtr(entities),
 		m_collistenerPtr(cL),
 		m_worldPtr(world), 
 		m_timer(0),
 		DJBoothComponent(pickUp)
 	{
-		
-
+		//Keep handles to the players, any that get knocked out will just stop resolving
+		for (auto& player : allPlayers)
+			m_players.push_back(player->handle());
 	}
 
 	//when run is called this will make all of the gravity component run when triggered
@@ -47,9 +48,13 @@ public:
 	{
 
 		m_timer = 10; //10 seconds flipped
-		for (auto& comp : m_entities)
+		for (auto& handle : m_players)
 		{
-			auto s = static_cast<SpriteComponent*>(&comp->getComponent("Sprite"));
+			auto player = m_entitiesPtr->get(handle);
+			if (nullptr == player)
+				continue;
+
+			auto s = player->get<SpriteComponent>();
 			s->setScale(s->getScale().x, -1);
 		}
 
@@ -61,9 +66,13 @@ public:
 	void unflipGrav()
 	{
 		m_timer = 0;
-		for (auto& comp : m_entities)
+		for (auto& handle : m_players)
 		{
-			auto s = static_cast<SpriteComponent*>(&comp->getComponent("Sprite"));
+			auto player = m_entitiesPtr->get(handle);
+			if (nullptr == player)
+				continue;
+
+			auto s = player->get<SpriteComponent>();
 			s->setScale(s->getScale().x, 1);
 		}
 		m_worldPtr->flipGravity();
@@ -74,7 +83,8 @@ public:
 	float& getTimeLeft() { return m_timer; }
 private:
 	float m_timer;
-	std::vector<Entity*> m_entities;
+	std::vector<EntityHandle> m_players;
+	EntityManager* m_entitiesPtr;
 	Box2DBridge* m_worldPtr;
 	PlayerPhysicsSystem* m_systemPtr;
 	CollisionListener* m_collistenerPtr;
@@ -1,6 +1,7 @@
 #ifndef INPUTCOMPONENT_H
 #define INPUTCOMPONENT_H
 
+#include "ControlComponent.h"
 #include "InputSystem.h"
 #include <utility>
 #include <string>
@@ -9,13 +10,18 @@
 typedef std::map<std::string, bool> Input;
 
 
-class InputComponent  : public Component {
+class InputComponent  : public ControlComponent {
 
 public: 
 	InputComponent()
 	{	
-		//Keep a pointer to the keyboard state
+		//Keep a pointer to the keyboard state, there is no keyboard when running headless
+#ifndef CYBERPUNCH_HEADLESS
 		m_keyStates = SDL_GetKeyboardState(NULL);
+#else
+		m_keyStates = nullptr;
+#endif
+		m_joycon = nullptr;
 
 		//Add buttons to our input handler
 		m_current["W"] = false;
@@ -48,7 +54,7 @@ public:
 		m_previous = m_current;
 		m_default = m_current;
 	}
-	virtual void handleInput(void* e) {}
+	void handleInput(Entity* e) override {}
 	void initialiseJoycon(int index)
 	{
 		SDL_JoystickEventState(SDL_ENABLE);
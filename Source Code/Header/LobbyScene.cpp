@@ -14,7 +14,7 @@ void LobbyScene::start()
 {
 	m_currentIndex = 0; //Start main menu at hovering over local play button
 
-	m_network = static_cast<OnlineSystem*>(Scene::systems()["Network"]);
+	m_network = Scene::systems().get<OnlineSystem>();
 	// Initialise SDL_net (Note: We don't initialise or use normal SDL at all - only the SDL_net library!)
 	if (SDLNet_Init() == -1)
 	{
@@ -47,7 +47,7 @@ void LobbyScene::start()
 
 	auto bgPos = new PositionComponent(960, 540);
 	m_bg.addComponent("Sprite", new SpriteComponent(bgPos, Vector2f(1920, 1080), Vector2f(1920, 1080), Scene::resources().getTexture("Lobby BG"), 0));
-	Scene::systems()["Render"]->addComponent(&m_bg.getComponent("Sprite"));
+	Scene::systems().get<RenderSystem>()->addComponent(&m_bg.getComponent("Sprite"));
 }
 
 void LobbyScene::stop()
@@ -55,13 +55,13 @@ void LobbyScene::stop()
 	//Remove components from systems
 	for (auto& btn : m_buttons)
 	{
-		Scene::systems()["Render"]->deleteComponent(&btn->getComponent("Sprite"));
-		Scene::systems()["Render"]->deleteComponent(&btn->getComponent("Player Num"));
-		Scene::systems()["Render"]->deleteComponent(&btn->getComponent("Lobby Num"));
-		Scene::systems()["Render"]->deleteComponent(&btn->getComponent("Password Sprite"));
+		Scene::systems().get<RenderSystem>()->deleteComponent(&btn->getComponent("Sprite"));
+		Scene::systems().get<RenderSystem>()->deleteComponent(&btn->getComponent("Player Num"));
+		Scene::systems().get<RenderSystem>()->deleteComponent(&btn->getComponent("Lobby Num"));
+		Scene::systems().get<RenderSystem>()->deleteComponent(&btn->getComponent("Password Sprite"));
 	}
-	Scene::systems()["Render"]->deleteComponent(&m_bg.getComponent("Sprite"));
-	Scene::systems()["Render"]->deleteComponent(&m_selectedBar.getComponent("Sprite"));
+	Scene::systems().get<RenderSystem>()->deleteComponent(&m_bg.getComponent("Sprite"));
+	Scene::systems().get<RenderSystem>()->deleteComponent(&m_selectedBar.getComponent("Sprite"));
 
 	//Clear the buttons vector
 	m_buttons.clear();
@@ -75,18 +75,18 @@ void LobbyScene::update(double dt)
 
 void LobbyScene::draw(SDL_Renderer & renderer)
 {
-	static_cast<RenderSystem*>(Scene::systems()["Render"])->render(renderer, m_camera);
+	Scene::systems().get<RenderSystem>()->render(renderer, m_camera);
 }
 
 void LobbyScene::handleInput(InputSystem & input)
 {
 	//Update the input system
-	Scene::systems()["Input"]->update(0);
+	Scene::systems().get<InputSystem>()->update(0);
 
 	//If the main menu input component is not added to the system, add it
 	if (!m_addedInput)
 	{
-		m_input = static_cast<InputComponent*>(Scene::systems()["Input"]->m_components.at(0));
+		m_input = static_cast<InputComponent*>(Scene::systems().get<InputSystem>()->m_components.at(0));
 		m_addedInput = true;
 	}
 	else
@@ -127,7 +127,7 @@ void LobbyScene::handleInput(InputSystem & input)
 		//If the button we are highlighting has changed, deslect the current button and select the new one
 		if (newIndex != m_currentIndex)
 		{
-			Scene::systems()["Render"]->addComponent(&m_buttons.at(m_currentIndex)->getComponent("Sprite"));
+			Scene::systems().get<RenderSystem>()->addComponent(&m_buttons.at(m_currentIndex)->getComponent("Sprite"));
 
 			//Set new button index
 			m_currentIndex = newIndex;
@@ -135,7 +135,7 @@ void LobbyScene::handleInput(InputSystem & input)
 			//Move the selected bar to the correct location
 			static_cast<PositionComponent*>(&m_selectedBar.getComponent("Pos"))->position = Vector2f(960, 280 + (120 * m_currentIndex));
 
-			Scene::systems()["Render"]->deleteComponent(&m_buttons.at(m_currentIndex)->getComponent("Sprite"));
+			Scene::systems().get<RenderSystem>()->deleteComponent(&m_buttons.at(m_currentIndex)->getComponent("Sprite"));
 		}
 	}
 }
@@ -178,11 +178,11 @@ void LobbyScene::createLobbyButtons()
 {
 	for (auto but : m_buttons)
 	{
-		Scene::systems()["Render"]->deleteComponent(&but->getComponent("Sprite"));
-		Scene::systems()["Render"]->deleteComponent(&but->getComponent("Player Num"));
-		Scene::systems()["Render"]->deleteComponent(&but->getComponent("Lobby Num"));
-		Scene::systems()["Render"]->deleteComponent(&but->getComponent("Password Sprite"));
-		Scene::systems()["Render"]->deleteComponent(&m_selectedBar.getComponent("Sprite"));
+		Scene::systems().get<RenderSystem>()->deleteComponent(&but->getComponent("Sprite"));
+		Scene::systems().get<RenderSystem>()->deleteComponent(&but->getComponent("Player Num"));
+		Scene::systems().get<RenderSystem>()->deleteComponent(&but->getComponent("Lobby Num"));
+		Scene::systems().get<RenderSystem>()->deleteComponent(&but->getComponent("Password Sprite"));
+		Scene::systems().get<RenderSystem>()->deleteComponent(&m_selectedBar.getComponent("Sprite"));
 		delete(but);
 	}
 	m_buttons.clear();
@@ -196,7 +196,7 @@ void LobbyScene::createLobbyButtons()
 			auto pos = new PositionComponent(960, 280);
 			m_selectedBar.addComponent("Pos", pos);
 			m_selectedBar.addComponent("Sprite", new SpriteComponent(pos, Vector2f(760, 135), Vector2f(760, 135), Scene::resources().getTexture("Lobby Bar Selected"), 2));
-			Scene::systems()["Render"]->addComponent(&m_selectedBar.getComponent("Sprite"));
+			Scene::systems().get<RenderSystem>()->addComponent(&m_selectedBar.getComponent("Sprite"));
 		}
 	}
 }
@@ -221,10 +221,10 @@ Entity* LobbyScene::createButton(Vector2f position, int index, std::string btnTa
 
 	//Add sprite component to the render system
 	if(index != 1)
-		Scene::systems()["Render"]->addComponent(&btn->getComponent("Sprite"));
-	Scene::systems()["Render"]->addComponent(&btn->getComponent("Player Num"));
-	Scene::systems()["Render"]->addComponent(&btn->getComponent("Lobby Num"));
-	Scene::systems()["Render"]->addComponent(&btn->getComponent("Password Sprite"));
+		Scene::systems().get<RenderSystem>()->addComponent(&btn->getComponent("Sprite"));
+	Scene::systems().get<RenderSystem>()->addComponent(&btn->getComponent("Player Num"));
+	Scene::systems().get<RenderSystem>()->addComponent(&btn->getComponent("Lobby Num"));
+	Scene::systems().get<RenderSystem>()->addComponent(&btn->getComponent("Password Sprite"));
 
 	//Return the created btn
 	return btn;
@@ -12,7 +12,7 @@ public:
 	MainMenuScene();
 	void start();
 	void stop();
-	Entity* createButton(Vector2f pos, SDL_Texture* selectedTexture, std::string btnTag, bool selected);
+	Entity* createButton(Vector2f pos, TextureRegion selectedTexture, std::string btnTag, bool selected);
 	void update(double dt);
 	void draw(SDL_Renderer& renderer);
 	void handleInput(InputSystem& input);
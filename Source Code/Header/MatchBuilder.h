@@ -0,0 +1,71 @@
+#ifndef MATCHBUILDER_H
+#define MATCHBUILDER_H
+
+#include <initializer_list>
+#include <vector>
+#include "json.hpp"
+#include "Box2DBridge.h"
+#include "CollisionListener.h"
+#include "EntityManager.h"
+#include "EntityCommandBuffer.h"
+#include "Observer.h"
+#include "Random.h"
+#include "Replay.h"
+#include "SystemRegistry.h"
+#include "TextureRegion.h"
+#include "Vector2f.h"
+
+using json = nlohmann::json;
+
+class AudioComponent;
+class ResourceHandler;
+
+//Makes and takes apart the entities of a match for both the GameScene and the MatchInstance,
+//so a match played headless or from a replay is built exactly like the one in the game.
+//Only the simulation side is done here, the entities, their bodies and the match systems they go in.
+//The positions, sprites and animations are packed in the entity manager, drawing them, the input devices
+//and the network are left to the GameScene.
+//Without resources (always when headless) the sprites and sounds are made without their textures and sound effects
+class MatchBuilder
+{
+public:
+	MatchBuilder(EntityManager& entities, EntityCommandBuffer& commands, Box2DBridge& world, CollisionListener& collisions,
+		Random& random, achi::Listener& events, std::vector<Entity*>& players, std::vector<Entity*>& platforms);
+
+	//Makes the players in the order of the slots, then the pickup, booths, kill boxes and platforms of the level.
+	//The bodies have to be made in this order for a replay to play out the same
+	void create(const json& level, const std::vector<Replay::Player>& slots, SystemRegistry& systems, ResourceHandler* resources = nullptr);
+
+	//Takes a knocked out player out of the match systems, the world and the players, the entity goes at the next flush
+	void removePlayer(Entity* player);
+
+	//Empties the match systems, deletes the world and frees every entity of the match
+	void destroy();
+
+	const std::vector<Entity*>& booths() const { return m_booths; }
+private:
+	Entity* createPlayer(Replay::PlayerType type, int index);
+	Entity* createPickUp();
+	Entity* createDJB(int index, int posX, int posY);
+	Entity* createKillBox(int posX, int posY, int width, int height);
+	void createPlatforms(const json& level);
+
+	TextureRegion texture(const std::string& name);
+	void addSounds(AudioComponent& audio, std::initializer_list<const char*> names);
+
+	EntityManager* m_entitiesPtr;
+	EntityCommandBuffer* m_commandsPtr;
+	Box2DBridge* m_worldPtr;
+	CollisionListener* m_collisionsPtr;
+	Random* m_randomPtr;
+	achi::Listener* m_eventsPtr;
+	std::vector<Entity*>* m_playersPtr; //Players still in the match, the AI and gravity booth look at these
+	std::vector<Entity*>* m_platformsPtr; //Moved by the platform booth and recoloured by the booth system
+	SystemRegistry* m_systemsPtr; //Set by create()
+	ResourceHandler* m_resourcesPtr;
+	std::vector<Vector2f> m_spawnPositions;
+	std::vector<Entity*> m_booths;
+	Entity* m_pickUp;
+};
+
+#endif
@@ -0,0 +1,102 @@
+#ifndef MATCHINSTANCE_H
+#define MATCHINSTANCE_H
+
+#include <vector>
+#include "json.hpp"
+#include "Box2DBridge.h"
+#include "CollisionListener.h"
+#include "EntityManager.h"
+#include "EntityCommandBuffer.h"
+#include "MatchBuilder.h"
+#include "Observer.h"
+#include "Random.h"
+#include "SystemRegistry.h"
+#include "SystemScheduler.h"
+#include "Replay.h"
+#include "Vector2f.h"
+
+using json = nlohmann::json;
+
+class AttackSystem;
+class AISystem;
+class AnimationSystem;
+class DJBoothSystem;
+class PhysicsSystem;
+class PickUpSystem;
+class PlayerPhysicsSystem;
+class PlayerRespawnSystem;
+
+//A match with no window, audio or network, built from the same level data and systems as the GameScene.
+//It owns its own world, entities, systems, random numbers and event listener so nothing is shared with the game
+//or with another match, and matches can be stepped side by side on different threads (see MatchRunner).
+//Either every player is a bot, or the players and their input come from a replay of a match from the game
+class MatchInstance
+{
+public:
+	MatchInstance(const json& level, int bots, uint64_t seed, WorkerPool* workers = nullptr);
+	MatchInstance(const json& level, Replay& replay, WorkerPool* workers = nullptr);
+	~MatchInstance();
+
+	//Moves the match on by one step, does nothing once the match is over
+	void update(double dt);
+
+	//Times the systems and Box2D under the Profiler's zones, on by default. The profiler is shared by the
+	//whole process, so matches being run side by side turn it off rather than queue on its lock every step
+	void setProfiled(bool profiled);
+
+	//Solves the Box2D islands on the pool, nullptr to go back to one at a time. The pool must outlive the match
+	void setTaskPool(b2TaskPool* pool);
+
+	bool isOver() const { return m_over; }
+	int winner() const { return m_winner; } //Player number of the last one standing, -1 for a draw or a match that hasn't ended
+	int playersLeft() const { return m_players.size(); }
+	double elapsed() const { return m_elapsed; }
+	int steps() const { return m_steps; }
+
+	//Hash of every body's position and velocity and every player's lives and damage taken. Two runs of the same match
+	//only hash the same if they were stepped to the same bits, so a run can be checked against another
+	uint64_t stateHash();
+private:
+	MatchInstance(const MatchInstance&) = delete;
+	MatchInstance& operator=(const MatchInstance&) = delete;
+
+	void create(const json& level, const std::vector<Replay::Player>& players, uint64_t seed);
+	void handleInput();
+	void removeDeadPlayers();
+
+	const float START_TIME = 3; //Same countdown as the game, nobody moves until it runs out
+
+	Random m_random; //Everything random in the match draws from this, seeded when the match is made
+	achi::Listener m_events; //Nothing observes a match with no window, the players and booths still need one to send to
+	Box2DBridge m_physicsWorld;
+	CollisionListener m_collisionListener;
+	EntityManager m_entityManager;
+	EntityCommandBuffer m_commands;
+	MatchBuilder m_builder; //Makes the match the same way the GameScene does
+	SystemRegistry m_systems;
+	SystemScheduler m_scheduler;
+	//Systems the match touches outside of the scheduler
+	AttackSystem* m_attackSysPtr;
+	AISystem* m_aiSysPtr;
+	AnimationSystem* m_animationSysPtr;
+	DJBoothSystem* m_boothSysPtr;
+	PhysicsSystem* m_physicsSysPtr;
+	PickUpSystem* m_pickUpSysPtr;
+	PlayerPhysicsSystem* m_playerPhysicsSysPtr;
+	PlayerRespawnSystem* m_respawnSysPtr;
+
+	Replay* m_playbackPtr; //nullptr for a bot match
+	std::vector<Replay::Player> m_slots;
+	std::vector<Entity*> m_slotPlayers; //Same order as the slots, nullptr once they're knocked out
+	std::vector<Entity*> m_players; //Players still in the match
+	std::vector<Entity*> m_platforms;
+	float m_startTimer; //Float like the GameScene's so the match starts on the same tick
+	bool m_started;
+	double m_elapsed;
+	int m_steps;
+	int m_winner;
+	bool m_over;
+	bool m_profiled;
+};
+
+#endif
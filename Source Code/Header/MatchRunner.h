@@ -0,0 +1,37 @@
+#ifndef MATCHRUNNER_H
+#define MATCHRUNNER_H
+
+#include <memory>
+#include <vector>
+#include "MatchInstance.h"
+#include "WorkerPool.h"
+
+//Steps many matches at once on a pool of worker threads, a match at a time per thread. Matches share nothing, and
+//a match is only ever stepped by one thread at a time, so the block and stack allocators of its Box2D world are
+//only used by the thread stepping it and nothing is locked while they run. Matches are not profiled once added
+class MatchRunner
+{
+public:
+	MatchRunner(unsigned int threads);
+
+	//The runner owns the match from here on
+	void add(MatchInstance* match);
+
+	//Steps every match that isn't over once, returns when they have all been stepped
+	void step(double dt);
+
+	//Steps every match until it is over or has played maxSeconds, a thread that finishes a match moves on to
+	//the next one that hasn't been started
+	void run(double dt, double maxSeconds);
+
+	const std::vector<std::unique_ptr<MatchInstance>>& matches() const { return m_matches; }
+	unsigned int threads() const { return m_workers.size(); }
+private:
+	MatchRunner(const MatchRunner&) = delete;
+	MatchRunner& operator=(const MatchRunner&) = delete;
+
+	WorkerPool m_workers;
+	std::vector<std::unique_ptr<MatchInstance>> m_matches;
+};
+
+#endif
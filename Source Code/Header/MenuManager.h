@@ -15,8 +15,9 @@ public:
 	void draw(SDL_Renderer& renderer);
 	void handleInput(InputSystem& input);
 	void setResourceHandler(ResourceHandler& resources);
-	void setSystemPtr(std::map<std::string, System*>& systems);
+	void setSystemPtr(SystemRegistry& systems);
 	void setScene(std::string scene);
+	bool exiting() { return nullptr != m_current && m_current->exiting(); }
 	std::map<std::string, Scene*> m_scenes;
 private:
 	Scene* m_current; //Ptr to the curretn scene
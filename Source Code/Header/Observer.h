@@ -33,53 +33,64 @@ public:
 
 namespace achi
 {
-	struct Listener
+	//Passes events on to the observers of one match. Every match has its own, so matches running side by side
+	//never see each others events
+	class Listener
 	{
-		static void notify(Entity* entity, Event event)
+	public:
+		void notify(Entity* entity, Event event)
 		{
-			for (auto& observer : achi::Listener::obs)
+			for (auto& observer : m_observers)
 			{
 				observer->onNotify(entity, event);
 			}
 		}
-		static bool m_exit;
-		static int m_localPlayers;
-		static std::vector<Observer*> obs;
-		static Component* m_AchisPtr;
-		static std::vector<std::string> m_newUnlocks;
+
+		void addObserver(Observer* observer)
+		{
+			//Add the observer to the vector
+			m_observers.emplace_back(observer);
+		}
+
+		void removeObserver(Observer* observer)
+		{
+			//Remove observer from the vector
+			m_observers.erase(std::remove(m_observers.begin(), m_observers.end(), observer), m_observers.end());
+		}
+	private:
+		std::vector<Observer*> m_observers;
 	};
 }
 
+//Sends its events to the listener of the match it is in, nothing is sent until it has been given one
 class Subject
 {
 public:
+	Subject() : m_listenerPtr(nullptr) {}
 
-	void notify(Entity* entity, Event event)
-	{
-		for (auto& observer : achi::Listener::obs)
-		{
-			observer->onNotify(entity, event);
-		}
-	}
-
-	void addObserver(Observer* observer)
-	{
-		//Add the observer to the vector
-		achi::Listener::obs.emplace_back(observer);
-	}
+	void setListener(achi::Listener* listener) { m_listenerPtr = listener; }
 
-	void removeObserver(Observer* observer)
+	void notify(Entity* entity, Event event)
 	{
-		//Remove observer from the vector
-		achi::Listener::obs.erase(std::remove(achi::Listener::obs.begin(), achi::Listener::obs.end(), observer), achi::Listener::obs.end());
+		if (nullptr != m_listenerPtr)
+			m_listenerPtr->notify(entity, event);
 	}
+private:
+	achi::Listener* m_listenerPtr;
 };
 
+class AchievementComponent;
+
 class AchievementsListener : public Observer
 {
 public:
-	AchievementsListener(){}
+	AchievementsListener() : m_achievementsPtr(nullptr), m_localPlayers(0) {}
 
 	void onNotify(Entity* entiti, Event event);
+
+	void setAchievements(AchievementComponent* achievements) { m_achievementsPtr = achievements; }
+	void setLocalPlayers(int localPlayers) { m_localPlayers = localPlayers; }
 private:
+	AchievementComponent* m_achievementsPtr; //Where the achievements are unlocked, nothing is unlocked without one
+	int m_localPlayers; //Amount of local players in the match
 };
\ No newline at end of file
@@ -1,5 +1,5 @@
 #pragma once
-#include "Component.h"
+#include "ControlComponent.h"
 #include "PlayerComponent.h"
 #include "Commands.h"
 #include "nlohmann/json.hpp"
@@ -10,16 +10,20 @@ using nlohmann::json;
 using std::queue;
 using std::vector;
 
-class OnlineInputComponent : public Component {
+class OnlineInputComponent : public ControlComponent {
 public:
 	OnlineInputComponent();
 
-	void handleInput(void* e);
+	void handleInput(Entity* entity) override;
 	int addCommand(string);
 	void addPositions(float px, float py, float vx, float vy, float dvx, float dvy);
 
 	void syncPosition(Entity* entity, float px, float py, float vx, float vy, float dvx, float dvy);
 
+	//What handleInput will use up next, the replay records these
+	const queue<string>& commands() const { return m_commandsToSend; }
+	const queue<OnlineSendComponent::syncStruct>& positions() const { return m_positionsToSyncTo; }
+
 	int m_playerNumber;
 private:
 
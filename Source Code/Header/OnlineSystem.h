@@ -3,7 +3,9 @@
 #include "ClientSocket.h"
 #include "OnlineSendComponent.h"
 #include "OnlineInputComponent.h"
+#ifdef _WIN32
 #include <Windows.h>
+#endif
 #include <math.h>
 
 using std::vector;
@@ -20,6 +22,9 @@ public:
 	void addComponent(Component *);
 	void addSendingPlayer(OnlineSendComponent*);
 	void addReceivingPlayer(OnlineInputComponent*);
+	void removeSendingPlayer(OnlineSendComponent*);
+	void removeReceivingPlayer(OnlineInputComponent*);
+	void removeAllComponents() override;
 
 	void update(double dt);
 
@@ -2,32 +2,36 @@
 #define PHYSICSCOMPONENT_H
 
 #include "Box2DBridge.h"
+#include "CollisionCategory.h"
+#include "Entity.h"
 #include "PositionComponent.h"
 #include "AudioComponent.h"
 
-class PhysicsComponent : public Component
+class PhysicsComponent : public Component, public Pooled<PhysicsComponent>
 {
 public:
-	PhysicsComponent(PositionComponent* pos) : m_body(nullptr), posPtr(pos){}
+	PhysicsComponent(Entity* owner) : m_body(nullptr), ownerPtr(owner){}
 
 	//The body of the physics component
 	Box2DBody* m_body;
 
-	//Hold a ptr to the position component that the physics modifies
-	PositionComponent * posPtr; 
+	//The entity whose position the physics modifies, nullptr for bodies that nothing is drawn at (hitboxes, the pickup's)
+	Entity * ownerPtr;
 
-	//This is used for filtering collisions in our collision listener
+	//This is used for filtering collisions in our collision listener, the listener goes by the category
 	struct ColData
 	{
 	public:
-		ColData(std::string _tag, void* data) : tag(_tag), objectData(data) {}
+		ColData(std::string _tag, void* data) : tag(_tag), category(CollisionCategory::fromTag(_tag)), objectData(data) {}
 
-		std::string Tag() { return tag; }
+		const std::string& Tag() const { return tag; }
+		CollisionCategory::Type Category() const { return category; }
 		void* Data() { return objectData; }
 	private:
 		std::string tag;
+		CollisionCategory::Type category;
 		void* objectData;
-		
+
 	};
 };
 
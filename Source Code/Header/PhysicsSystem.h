@@ -1,17 +1,25 @@
 #pragma once
-#include "System.h"
+#include "TypedSystem.h"
 #include "PhysicsComponent.h"
+#include "EntityManager.h"
 
-class PhysicsSystem : public System
+class PhysicsSystem : public TypedSystem<PhysicsComponent>
 {
 public:
-	PhysicsSystem() : m_gravFlipped(false) {}
+	PhysicsSystem() : m_gravFlipped(false), m_entitiesPtr(nullptr) {}
 	void addComponent(Component* comp);
 	void update(double dt);
+	void setEntities(EntityManager* entities) { m_entitiesPtr = entities; } //Where the positions are packed, nullptr when the match is over
+	SystemAccess access() const override
+	{
+		return SystemAccess().read<PhysicsComponent>().write<PositionComponent>()
+			.readResource(SystemAccess::PHYSICS_WORLD);
+	}
 	void flipGravity();
 	void addForce(Box2DBody& body, Vector2f force);
 	void addForce(Box2DBody& body, float forceX, float forceY);
 private:
 	bool m_gravFlipped;
 	float m_scaler = 0.0;
+	EntityManager* m_entitiesPtr;
 };
\ No newline at end of file
@@ -0,0 +1,22 @@
+#ifndef PHYSICSTASKPOOL_H
+#define PHYSICSTASKPOOL_H
+
+#include <Box2D/Box2D.h>
+#include "WorkerPool.h"
+
+//Lets a Box2D world solve its islands on a WorkerPool, see b2World::SetTaskPool. The thread stepping the world
+//solves a share of the islands too, so there is one more task than there are workers.
+//Off unless a world is given one, each task costs a job on the pool so it only pays off with lots of islands.
+//Each step only waits on its own tasks, so worlds stepped on different threads can share one pool
+class PhysicsTaskPool : public b2TaskPool
+{
+public:
+	PhysicsTaskPool(WorkerPool& workers);
+
+	int32 GetWorkerCount() const override;
+	void Run(b2Task* task, int32 count) override;
+private:
+	WorkerPool& m_workers;
+};
+
+#endif
@@ -2,15 +2,13 @@
 #include "Box2DBridge.h"
 #include "Entity.h"
 #include "PhysicsComponent.h"
+#include "Random.h"
 
 class PickUpComponent : public Component
 {
 public: 
-	PickUpComponent(Entity* pickupEntity);
-	~PickUpComponent()
-	{
-
-	}
+	PickUpComponent(Entity* pickupEntity, Random& random);
+	~PickUpComponent() { delete m_body; }
 
 	void spawn(Box2DBridge& world);
 	void despawn(Box2DBridge& world);
@@ -44,6 +42,7 @@ private:
 	Vector2f m_pos4 = Vector2f(1650, 840);
 	Vector2f m_pos5 = Vector2f(250, 260);
 	PhysicsComponent* m_body;
+	Random& m_random; //The match's generator, picks where the pickup goes next
 	Entity* m_playerToTele, *m_pickupEntity;
 	bool m_teleport;
 	bool m_back;
@@ -4,19 +4,27 @@
 #include "PickUpComponent.h"
 #include "OnlineSystem.h"
 
+class PlayerPhysicsComponent;
+class PositionComponent;
+class SpriteComponent;
+
 class PickUpSystem : public System
 {
 public:
-	PickUpSystem(System* renderSys, OnlineSystem* netSys) :
-		m_renderSysPtr(renderSys),
+	//The pickup's sprite is only shown while it's out, the network can be nullptr when running headless
+	PickUpSystem(OnlineSystem* netSys) :
 		m_netSysPtr(netSys)
 	{}
 	void setWorld(Box2DBridge& world);
 	void addComponent(Component* comp);
 	void update(double dt);
+	SystemAccess access() const override
+	{
+		return SystemAccess().write<PickUpComponent>().write<PlayerPhysicsComponent>().write<PositionComponent>().write<SpriteComponent>()
+			.writeResource(SystemAccess::PHYSICS_WORLD | SystemAccess::RANDOM);
+	}
 private:
 	Box2DBridge * m_worldPtr;
-	System* m_renderSysPtr;
 	OnlineSystem* m_netSysPtr;
 };
 
@@ -27,17 +27,17 @@ public:
 		{
 			if (i < 9)
 			{
-				firstPair.m_offsets.push_back(static_cast<PositionComponent&>(m_entities->at(i)->getComponent("Pos")).position - firstPoint);
+				firstPair.m_offsets.push_back(m_entities->at(i)->get<PositionComponent>()->position - firstPoint);
 				firstPair.m_platforms.push_back(m_entities->at(i));
 			}
 			else if (i < 15)
 			{
-				secondPair.m_offsets.push_back(static_cast<PositionComponent&>(m_entities->at(i)->getComponent("Pos")).position - secondPoint);
+				secondPair.m_offsets.push_back(m_entities->at(i)->get<PositionComponent>()->position - secondPoint);
 				secondPair.m_platforms.push_back(m_entities->at(i));
 			}
 			else if (i < 25)
 			{
-				thirdPair.m_offsets.push_back(static_cast<PositionComponent&>(m_entities->at(i)->getComponent("Pos")).position - thirdPoint);
+				thirdPair.m_offsets.push_back(m_entities->at(i)->get<PositionComponent>()->position - thirdPoint);
 				thirdPair.m_platforms.push_back(m_entities->at(i));
 			}
 		}
@@ -67,7 +67,7 @@ public:
 
 				//for (auto& comp : *m_entities)
 				//{
-					/*auto platform = static_cast<PhysicsComponent*>(&comp->getComponent("Physics"));
+					/*auto platform = comp->get<PhysicsComponent>();
 
 					if (comp->m_ID == "Platform")
 					{
@@ -123,7 +123,7 @@ public:
 					pair.first.x = 4800;
 				for (int i = 0; i< pair.second.m_offsets.size(); i++)
 				{
-					auto phys = static_cast<PhysicsComponent*>(&pair.second.m_platforms.at(i)->getComponent("Physics"));
+					auto phys = pair.second.m_platforms.at(i)->get<PhysicsComponent>();
 					auto newPos = pair.first + pair.second.m_offsets.at(i);
 					phys->m_body->setPosition(newPos.x, newPos.y);
 				}
@@ -5,15 +5,8 @@
 class PlatformComponent : public Component
 {
 public:
-	PlatformComponent() {}
-	~PlatformComponent()
-	{
-		//Free the memory our pointers took up
-		delete m_blue;
-		delete m_green;
-		delete m_pink;
-		delete m_orange;
-	}
+	//The textures belong to the resource handler's platform cache, other platforms of the same size share them
+	PlatformComponent() : m_blue(nullptr), m_green(nullptr), m_pink(nullptr), m_orange(nullptr) {}
 
 	void setBlue(SDL_Texture* blue) { m_blue = blue; }
 	void setGreen(SDL_Texture* green) { m_green = green; }
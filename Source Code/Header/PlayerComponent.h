@@ -1,18 +1,24 @@
 #pragma once
 #include "Vector2f.h"
-#include "Entity.h"
+#include "EntityManager.h"
 #include "PlayerPhysicsComponent.h"
 #include "OnlineSendComponent.h"
 #include "AudioComponent.h"
+#include "Observer.h"
+#include "Random.h"
 
-class PlayerComponent : public Component
+//Sends its events to the listener of the match the player is in, everything random the player does draws from
+//the match's generator
+class PlayerComponent : public Component, public Subject
 {
 public:
-	PlayerComponent(std::vector<Vector2f> locations, Entity* player, int index) :
+	PlayerComponent(std::vector<Vector2f> locations, Entity* player, int index, EntityManager* entities, Random& random) :
 		m_dead(false),
 		m_lives(3),
 		m_newSpawn(nullptr),
 		m_playerPtr(player),
+		m_entitiesPtr(entities),
+		m_random(random),
 		m_spawnLocations(locations),
 		m_respawn(false),
 		m_respawning(false),
@@ -21,7 +27,10 @@ public:
 		m_dmgDealt(0),
 		m_dmgTaken(0),
 		m_supersUsed(0),
-		m_hitBy(nullptr),
+		m_timesStunned(0),
+		m_timesSuperStunned(0),
+		m_spawnTimer(0),
+		m_audioCreated(false),
 		m_hitWith(""),
 		m_superPercentSpeed(0.05f)
 	{
@@ -35,14 +44,16 @@ public:
 
 
 		if (m_hitWith == "Kick" && m_playerPtr->m_ID == "AI")
-			achi::Listener::notify(nullptr, KICK_DEATH);
+			notify(nullptr, KICK_DEATH);
 		
-		if (m_playerPtr->m_ID == "AI" && (nullptr != m_hitBy))
+		//The player that hit us may have been knocked out already, the handle wont resolve if so
+		auto hitBy = m_entitiesPtr->get(m_hitBy);
+		if (m_playerPtr->m_ID == "AI" && (nullptr != hitBy))
 		{
-			if (m_hitBy->m_ID != "AI")
+			if (hitBy->m_ID != "AI")
 			{
-				achi::Listener::notify(nullptr, AI_DEATH);
-				achi::Listener::notify(nullptr, PLAYER_DEATH);
+				notify(nullptr, AI_DEATH);
+				notify(nullptr, PLAYER_DEATH);
 			}
 		}
 
@@ -58,15 +69,15 @@ public:
 			m_respawning = true;
 			m_respawn = true;
 			m_spawnTimer = 2.5f; //Respawn after 2.5 seconds
-			m_newSpawn = &m_spawnLocations.at(rand() % m_spawnLocations.size()); //Number between 0 and the size of the amount of spawn points	
+			m_newSpawn = &m_spawnLocations.at(m_random.range(m_spawnLocations.size())); //Number between 0 and the size of the amount of spawn points	
 		}
-		static_cast<AudioComponent&>(m_playerPtr->getComponent("Audio")).playSound("KnockOut", false);
-		auto net = static_cast<OnlineSendComponent*>(&m_playerPtr->getComponent("Send"));
+		m_playerPtr->get<AudioComponent>()->playSound("KnockOut", false);
+		auto net = m_playerPtr->get<OnlineSendComponent>();
 		if (net != NULL)
 		{
-			auto phys = static_cast<PlayerPhysicsComponent*>(&m_playerPtr->getComponent("Player Physics"));
+			auto phys = m_playerPtr->get<PlayerPhysicsComponent>();
 			net->addCommand("RESPAWN");
-			net->setSync(phys->posPtr->position, Vector2f(phys->m_currentVel.x, phys->m_currentVel.y), Vector2f(phys->m_desiredVel.x, phys->m_desiredVel.y));
+			net->setSync(m_playerPtr->get<PositionComponent>()->position, Vector2f(phys->m_currentVel.x, phys->m_currentVel.y), Vector2f(phys->m_desiredVel.x, phys->m_desiredVel.y));
 		}
 	}
 
@@ -76,19 +87,16 @@ public:
 		m_respawning = false;
 		m_spawnTimer = 0;
 		//m_audio.playSound("Spawn", true);
-		static_cast<AudioComponent&>(m_playerPtr->getComponent("Audio")).playSound("Spawn", false);
-		auto phys = static_cast<PlayerPhysicsComponent*>(&m_playerPtr->getComponent("Player Physics"));
+		m_playerPtr->get<AudioComponent>()->playSound("Spawn", false);
+		auto phys = m_playerPtr->get<PlayerPhysicsComponent>();
 		//Set the players position to the new position
 		phys->m_body->setPosition(m_newSpawn->x, m_newSpawn->y);
-		phys->m_jumpSensor->setPosition(m_newSpawn->x, m_newSpawn->y);
 		phys->m_body->getBody()->SetAngularVelocity(0);
 		phys->m_body->getBody()->SetLinearVelocity(b2Vec2(0,0));
-		phys->m_jumpSensor->getBody()->SetAngularVelocity(0);
-		phys->m_jumpSensor->getBody()->SetLinearVelocity(b2Vec2(0, 0));
 		phys->damagePercentage() = 0; //Reset the damage percentage
 
 		m_hitWith = "";
-		m_hitBy = nullptr;
+		m_hitBy = EntityHandle();
 	}
 
 	Vector2f getSpawnLocation() { return *m_newSpawn; }
@@ -101,14 +109,17 @@ public:
 	bool& isWinner() { return m_winner; }
 	bool& isDJ() { return inDJBooth; }
 	void setDJ(bool c) { inDJBooth = c; }
+	Random& random() { return m_random; }
 	int m_dmgTaken, m_dmgDealt, m_timesStunned, m_timesSuperStunned, m_supersUsed;
 	int m_playerIndex;
-	Entity* m_hitBy;
+	EntityHandle m_hitBy; //The last player to hit this player
 	std::string m_hitWith;
 	float m_superPercentSpeed;
 private:
 	float m_spawnTimer;
 	Entity * m_playerPtr;
+	EntityManager* m_entitiesPtr;
+	Random& m_random;
 	Vector2f* m_newSpawn;
 	std::vector<Vector2f> m_spawnLocations;
 	bool m_dead, m_respawn, m_respawning, m_winner;
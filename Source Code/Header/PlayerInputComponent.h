@@ -12,15 +12,14 @@ public:
 	{
 
 	}
-	void handleInput(void* e) override
+	void handleInput(Entity* entity) override
 	{
 		m_currentCMD = nullptr;
-		auto entity = static_cast<Entity*>(e);
 
-		auto net = static_cast<OnlineSendComponent*>(&entity->getComponent("Send"));
+		auto net = entity->get<OnlineSendComponent>();
 		if (net != NULL)
 		{
-			auto phys = static_cast<PlayerPhysicsComponent*>(&entity->getComponent("Player Physics"));
+			auto phys = entity->get<PlayerPhysicsComponent>();
 			net->setSync(phys->m_body->getPosition(), Vector2f(phys->m_currentVel.x, phys->m_currentVel.y), Vector2f(phys->m_desiredVel.x, phys->m_desiredVel.y));
 		}
 
@@ -70,13 +69,13 @@ public:
 
 			m_currentCMD->execute(*entity);
 		}
-		else if (static_cast<AttackComponent*>(&entity->getComponent("Attack"))->attackActive() == false
-		&& !(static_cast<AnimationComponent*>(&entity->getComponent("Animation"))->getCurrentID() == "Jump"
-		&& static_cast<AnimationComponent*>(&entity->getComponent("Animation"))->getCurrentAnimation()->getCompleted() == false)
-		&& static_cast<PlayerPhysicsComponent*>(&entity->getComponent("Player Physics"))->stunned() == false)
+		else if (entity->get<AttackComponent>()->attackActive() == false
+		&& !(entity->get<AnimationComponent>()->getCurrentID() == "Jump"
+		&& entity->get<AnimationComponent>()->getCurrentAnimation()->getCompleted() == false)
+		&& entity->get<PlayerPhysicsComponent>()->stunned() == false)
 		{
       		m_idleCMD.execute(*entity);
-			//static_cast<AnimationComponent*>(&entity->getComponent("Animation"))->playAnimation("Idle", true);
+			//entity->get<AnimationComponent>()->playAnimation("Idle", true);
 		}
 
 		m_previousCMD = m_currentCMD;
@@ -1,11 +1,12 @@
 #pragma once
 #include "Box2DBridge.h"
+#include "Entity.h"
 #include "PositionComponent.h"
 
 class PlayerPhysicsComponent : public Component
 {
 public:
-	PlayerPhysicsComponent(Component* pos);
+	PlayerPhysicsComponent(Entity* owner);
 
 	//methods for modifying the player
 	void stun();
@@ -25,7 +26,7 @@ public:
 	void changeBodyType(b2BodyType type);
 	void applyDamageImpulse(float x, float y);
 	void flipGravity(Box2DBridge& world);
-	void createJoint(Box2DBridge& world);
+	void createBody(Box2DBridge& world, int posX, int posY, void* player);
 
 	//Getter methods
 	bool& stunned() { return m_stunned; };
@@ -54,15 +55,15 @@ public:
 	//---Member variables---//
 	//The body of the physics component
 	Box2DBody* m_body;
-	Box2DBody* m_jumpSensor;
-	//Hold a ptr to the position component that the physics modifies
-	PositionComponent * posPtr;
+	//Sensor fixture on the body at the players feet, or their head while gravity is flipped
+	b2Fixture* m_jumpSensor;
+	//The player, its position is the one the physics modifies
+	Entity * ownerPtr;
 	b2Vec2 m_currentVel, m_desiredVel;
 private:
 	bool m_setStatic, m_setDynamic;
 	float clamp(float min, float& val, float max);
-	b2RevoluteJointDef m_sensorJointDef;
-	b2RevoluteJoint * m_sensorJoint;
+	void createJumpSensor(Box2DBridge& world, void* data);
 	bool m_falling, m_stunned, m_canJump, m_canFall, m_movingL, m_movingR, m_gravFlipped, m_supered, m_stunnedBySuper;
 	float m_stunLeft, m_moveSpeed, m_jumpDownSpeed, m_jumpSpeed;
 	float m_superTime;
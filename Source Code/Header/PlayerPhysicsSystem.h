@@ -3,18 +3,26 @@
 #define PLAYERPHYSICSSYSTEM_H
 #include "System.h"
 #include "PlayerPhysicsComponent.h"
+#include "EntityManager.h"
 
 class PlayerPhysicsSystem : public System
 {
 public:
-	PlayerPhysicsSystem() : m_gravFlipped(false), m_gravityChange(false){}
+	PlayerPhysicsSystem() : m_gravFlipped(false), m_gravityChange(false), m_entitiesPtr(nullptr){}
 	void setWorld(Box2DBridge& world);
+	void setEntities(EntityManager* entities) { m_entitiesPtr = entities; } //Where the positions are packed, nullptr when the match is over
 	void addComponent(Component* comp);
 	void update(double dt);
+	SystemAccess access() const override
+	{
+		return SystemAccess().write<PlayerPhysicsComponent>().write<PositionComponent>()
+			.writeResource(SystemAccess::PHYSICS_WORLD);
+	}
 	void flipGravity();
 private:
 	Box2DBridge * m_worldPtr;
 	bool m_gravFlipped;
 	bool m_gravityChange;
+	EntityManager* m_entitiesPtr;
 };
 #endif
\ No newline at end of file
@@ -9,5 +9,10 @@ public:
 
 	void addComponent(Component* c);
 	void update(double dt);
+	SystemAccess access() const override
+	{
+		return SystemAccess().write<PlayerComponent>().write<PlayerPhysicsComponent>().write<AudioComponent>().write<OnlineSendComponent>()
+			.writeResource(SystemAccess::PHYSICS_WORLD | SystemAccess::AUDIO);
+	}
 private:
 };
\ No newline at end of file
@@ -5,7 +5,28 @@
 class PositionComponent : public Component
 {
 public:
-	PositionComponent(float x, float y) : position(x, y) {}
+	PositionComponent(float x, float y) : position(x, y), previous(x, y), interpolated(false) {}
+
+	//Called by the physics systems before they move the position each fixed step
+	void step(Vector2f next)
+	{
+		previous = position;
+		position = next;
+		interpolated = true;
+	}
+
+	//Where to draw between the last two steps, alpha is how far the frame is into the next step.
+	//Big jumps (teleports, respawns) aren't blended so nothing is drawn halfway across the level
+	Vector2f drawPosition(float alpha)
+	{
+		if (interpolated == false || previous.distance(position) > SNAP_DISTANCE)
+			return position;
+		return previous + (position - previous) * alpha;
+	}
 
 	Vector2f position;
+	Vector2f previous; //Position before the last step
+	bool interpolated; //Only positions moved by physics are blended, everything else is drawn where it is
+
+	static constexpr float SNAP_DISTANCE = 150.0f; //Further than anything moves in one step
 };
\ No newline at end of file
@@ -10,11 +10,12 @@ using std::pair;
 
 class PreGameScene : public Scene {
 public:
-	static struct PlayersInfo {
+	//Who is in the next match, the game scene reads it when the match starts
+	struct PlayersInfo {
 		vector<pair<int,int>> localPlyrs;
 		vector<int> onlinePlyrs;
 		vector<int> botPlyrs;
-	} playerIndexes;
+	};
 
 	PreGameScene();
 	void start();
@@ -26,10 +27,11 @@ public:
 	Entity* createBadge(int x, int y, bool isPlayer, int index);
 	void reconstructBadges();
 
-	//static PlayersInfo playerIndexes;
+	const PlayersInfo& playerIndexes() const { return m_playerIndexes; }
 
 private:
 	void checkForUpdates();
+	PlayersInfo m_playerIndexes;
 	vector<bool> m_availablePlyrs;
 	vector<pair<InputComponent*, int>> m_input;
 	//vector<bool> m_hasJoined;
@@ -0,0 +1,110 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+//Times named zones of the game loop. Each frame the time spent in every zone is added up, the last few seconds
+//of frames are kept so the overlay can show p50/p99 per zone. Zones can be timed from the worker threads too.
+//While a trace is being captured every zone is also kept as an event and written out as a csv
+//(frame,zone,thread,start_us,duration_us) or as a Chrome trace (chrome://tracing) when the trace stops
+class Profiler
+{
+public:
+	typedef std::chrono::steady_clock Clock;
+
+	struct Stats
+	{
+		std::string name;
+		double last; //Milliseconds in the most recent frame the zone ran
+		double p50;
+		double p99;
+	};
+
+	static Profiler& instance();
+
+	//Returns the index of the zone, adding it the first time the name is seen
+	int zoneId(const std::string& name);
+	void record(int zone, Clock::time_point start, Clock::time_point end);
+
+	void beginFrame();
+	void endFrame();
+
+	std::vector<Stats> stats();
+
+	//The format comes from the file extension, .json is a Chrome trace and anything else is csv
+	void startTrace(const std::string& path);
+	void stopTrace();
+	bool tracing() const { return m_tracing; }
+
+	static const int WINDOW = 240; //Frames kept for the percentiles
+	static const size_t MAX_EVENTS = 4000000; //Stops the trace before it eats all the memory
+private:
+	Profiler();
+	Profiler(const Profiler&) = delete;
+	Profiler& operator=(const Profiler&) = delete;
+
+	struct Zone
+	{
+		std::string name;
+		double frameTotal; //Added up over the frame, zones can run more than once
+		bool hit;
+		std::vector<double> samples; //Ring buffer of frame totals in ms
+		int next;
+		double last;
+	};
+
+	struct Event
+	{
+		int zone;
+		int thread;
+		long long frame;
+		long long start; //Microseconds since the trace started
+		long long duration;
+	};
+
+	int threadIndex(std::thread::id id);
+	void writeTrace();
+
+	std::mutex m_mutex;
+	std::vector<Zone> m_zones;
+	std::vector<std::thread::id> m_threads;
+	int m_frameZone;
+	Clock::time_point m_frameStart;
+	long long m_frame;
+
+	bool m_tracing;
+	std::string m_tracePath;
+	Clock::time_point m_traceStart;
+	std::vector<Event> m_events;
+};
+
+//Times the rest of the scope it is made in
+class ProfileZone
+{
+public:
+	ProfileZone(int zone) :
+		m_zone(zone),
+		m_start(Profiler::Clock::now())
+	{}
+	~ProfileZone()
+	{
+		Profiler::instance().record(m_zone, m_start, Profiler::Clock::now());
+	}
+private:
+	int m_zone;
+	Profiler::Clock::time_point m_start;
+};
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+
+//eg. PROFILE_ZONE("Render"); the name is only looked up the first time the line runs
+#define PROFILE_ZONE(name) \
+	static const int PROFILE_CONCAT(profileZoneId, __LINE__) = Profiler::instance().zoneId(name); \
+	ProfileZone PROFILE_CONCAT(profileZone, __LINE__)(PROFILE_CONCAT(profileZoneId, __LINE__))
+
+#endif
@@ -0,0 +1,37 @@
+#ifndef PROFILEROVERLAY_H
+#define PROFILEROVERLAY_H
+
+#include "SDL.h"
+#include "SDL_ttf.h"
+#include "Profiler.h"
+
+//Draws the profiler zones in the top left corner of the screen. The text is only rebuilt a couple of times a
+//second so the overlay doesn't show up in its own numbers, bars show the p50 with a line at the p99
+class ProfilerOverlay
+{
+public:
+	ProfilerOverlay();
+	~ProfilerOverlay();
+
+	void toggle() { m_visible = !m_visible; m_stale = true; }
+	bool visible() const { return m_visible; }
+
+	void draw(SDL_Renderer& renderer);
+private:
+	void rebuild(SDL_Renderer& renderer);
+
+	const double REFRESH = 0.5; //Seconds between text updates
+	const double BAR_MS = 16.6; //A full bar is one 60fps frame
+	const int LINE_HEIGHT = 20;
+	const int BAR_WIDTH = 200;
+
+	bool m_visible;
+	bool m_stale;
+	Profiler::Clock::time_point m_built;
+	TTF_Font* m_font;
+	SDL_Texture* m_text;
+	SDL_Rect m_textRect;
+	std::vector<Profiler::Stats> m_stats;
+};
+
+#endif
@@ -0,0 +1,27 @@
+#ifndef RANDOM_H
+#define RANDOM_H
+
+#include <cstdint>
+
+//Seedable random number generator (PCG32), the same seed always gives the same numbers on every platform which
+//rand() doesn't. Every match has its own that all of its gameplay draws from, systems that use it declare
+//SystemAccess::RANDOM so the scheduler never runs two of them at once and the numbers come out in the same order every run
+class Random
+{
+public:
+	typedef uint32_t result_type;
+
+	Random(uint64_t seed = 1);
+
+	void seed(uint64_t seed);
+	uint64_t seedValue() const { return m_seed; }
+
+	result_type operator()();
+	int range(int count); //0 up to but not including count
+	double real(); //0 up to but not including 1
+private:
+	uint64_t m_state;
+	uint64_t m_seed;
+};
+
+#endif
@@ -4,32 +4,116 @@
 #include "System.h"
 #include "Camera.h"
 #include <algorithm>
+#include <functional>
+#include <map>
+#include <unordered_map>
+#include <vector>
 #include <SDL.h>
+#include "EntityManager.h"
 #include "SpriteComponent.h"
 
+//Keeps sprites in a bucket per layer instead of one list sorted on every add.
+//Adding finds the layer bucket (log of the amount of layers), removing swaps the last sprite of the bucket into the hole.
+//Sprites marked static go into a coarse grid instead, so only the cells the camera sees are looked at.
+//The sprites packed in an entity manager aren't added, they are walked straight out of the manager every frame.
+//Packed sprites that never move are given to addStatic instead and go in the grid by their entity's handle
 class RenderSystem : public System
 {
 public:
 	RenderSystem();
+	~RenderSystem();
 	void update(double dt);
 	void addComponent(Component *);
+	void deleteComponent(Component *) override;
+	void removeAllComponents() override;
 	void render(SDL_Renderer& renderer, Camera& camera);
+	//How far the frame is between the last fixed step and the next one, 0 to 1
+	void setInterpolation(float alpha) { m_alpha = alpha; }
+	void setEntities(EntityManager* entities) { m_entitiesPtr = entities; } //nullptr when the match is over
+	//Puts the entity's packed sprite in the grid by where its position is now and marks it static, so the
+	//walk over the packed sprites skips it. Cleared with the rest by removeAllComponents
+	void addStatic(EntityHandle handle);
 
 private:
-	SDL_Rect m_spritePos;
+	//A sprite in a layer bucket, order is when it was added so sprites on the same layer draw in the order they were added
+	struct Entry
+	{
+		SpriteComponent* sprite;
+		unsigned int order;
+	};
 
-	//Struct used to sort the components based on their layer (smallest to biggest)
-	struct layerSorter
+	//Where a sprite is, the layer is the one it was added under so it can still be found if the sprite's layer changes
+	struct Location
 	{
-		inline bool operator() (Component* l, Component* r)
-		{
-			auto lhs = static_cast<SpriteComponent*>(l);
-			auto rhs = static_cast<SpriteComponent*>(r);
+		int layer;
+		size_t index;
+	};
+
+	//A sprite to draw this frame, sorted by layer then texture so sprites sharing a texture are drawn together
+	struct DrawItem
+	{
+		SpriteComponent* sprite;
+		SDL_Texture* texture;
+		int layer;
+		unsigned int order;
+		SDL_Rect dest; //Where it goes on screen, worked out when it was culled
 
-			return lhs->getLayer() < rhs->getLayer();
+		bool operator<(const DrawItem& other) const
+		{
+			if (layer != other.layer)
+				return layer < other.layer;
+			if (texture != other.texture)
+				return std::less<SDL_Texture*>()(texture, other.texture);
+			return order < other.order;
 		}
 	};
 
+	void drawPass(SDL_Renderer& renderer, Camera& camera, std::vector<DrawItem>& items);
+	bool drawWorldToTarget(SDL_Renderer& renderer, Camera& camera);
+	void drawRun(SDL_Renderer& renderer, Camera& camera, const DrawItem* begin, const DrawItem* end);
+	SDL_Rect destRect(SpriteComponent* sprite, Vector2f pos, Camera& camera);
+	void insert(SpriteComponent* sprite, unsigned int order);
+	void remove(SpriteComponent* sprite);
+	void insertStatic(SpriteComponent* sprite, unsigned int order);
+	bool removeStatic(SpriteComponent* sprite);
+	void addVisible(SpriteComponent* sprite, Vector2f pos, unsigned int order, Camera& camera, const SDL_Rect& area);
+	static bool overlaps(const SDL_Rect& rect, float angle, const SDL_Rect& area);
+
+	//A static sprite in the grid, frame stops a sprite covering several cells being drawn more than once
+	struct StaticEntry
+	{
+		unsigned int order;
+		SDL_Rect cells; //First and last cell covered, w and h are the last cell not the size
+		unsigned int frame;
+	};
+
+	static const int CELL_SIZE = 512;
+	static long long cellKey(int x, int y) { return ((long long)x << 32) ^ (unsigned int)y; }
+	static SDL_Rect cellsCovered(Vector2f pos, Vector2f size);
+
+	std::map<int, std::vector<Entry>> m_layers; //Sprites by layer, smallest layer first
+	std::unordered_map<SpriteComponent*, Location> m_locations;
+	std::vector<Entry> m_moved; //Sprites found on the wrong layer this frame
+	unsigned int m_nextOrder;
+	std::unordered_map<long long, std::vector<SpriteComponent*>> m_grid; //Static sprites by cell
+	std::unordered_map<SpriteComponent*, StaticEntry> m_static;
+	//Packed static sprites by cell, by handle as they move in the packed array. Found through the entity manager
+	//when drawn, one whose entity is gone is skipped
+	std::unordered_map<long long, std::vector<EntityHandle>> m_packedGrid;
+	std::unordered_map<uint32_t, StaticEntry> m_packedStatic; //By handle id
+	unsigned int m_frame;
+	float m_alpha;
+	EntityManager* m_entitiesPtr;
+
+	SDL_Rect m_spritePos;
+	SDL_Texture* m_worldTarget; //The world is drawn here unscaled and then stretched onto the screen in one copy
+	bool m_targetFailed; //The renderer can't draw to textures, scale the renderer instead
+	std::vector<DrawItem> m_worldItems; //Sprites drawn with the camera zoom
+	std::vector<DrawItem> m_screenItems; //Sprites drawn in screen space on top of the world (ui)
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+	std::vector<SDL_Vertex> m_vertices; //Reused every run so drawing doesn't allocate
+	std::vector<int> m_indices;
+#endif
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,74 @@
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "json.hpp"
+#include "InputComponent.h"
+#include "OnlineSendComponent.h"
+
+using json = nlohmann::json;
+
+//Everything needed to play a match again: the random seed, which level it was on, who played and what every
+//player's input was on every tick. Bots aren't recorded, the seed makes them do the same thing again.
+//Each tick holds one entry per player in the order they were added:
+//  local players - a 32 bit mask of the buttons the input system read
+//  online players - the command and position sync the online input used up that tick, if any
+//Players that have been knocked out still get an empty entry so the ticks stay the same size to read
+class Replay
+{
+public:
+	enum PlayerType
+	{
+		LOCAL,
+		ONLINE,
+		BOT
+	};
+	struct Player
+	{
+		PlayerType type;
+		int index; //Player number, also picks the spawn point
+	};
+
+	Replay();
+
+	static uint64_t hashLevel(const json& level);
+
+	//Recording
+	void begin(uint64_t seed, uint64_t levelHash, const std::vector<Player>& players);
+	void recordInput(const Input* input); //nullptr for a player that is out
+	void recordOnline(const std::string* command, const OnlineSendComponent::syncStruct* sync);
+	void endTick() { m_ticks++; }
+
+	bool save(const std::string& path) const;
+	bool load(const std::string& path);
+
+	//Playback, entries are read back in the order they were recorded
+	void rewind() { m_read = 0; m_ticksRead = 0; }
+	void readInput(Input& input);
+	bool readOnline(std::string& command, OnlineSendComponent::syncStruct& sync); //Returns true if there was a sync
+	void endReadTick() { m_ticksRead++; }
+	bool finished() const { return m_ticksRead >= m_ticks; }
+
+	uint64_t seed() const { return m_seed; }
+	uint64_t levelHash() const { return m_levelHash; }
+	const std::vector<Player>& players() const { return m_players; }
+	uint32_t ticks() const { return m_ticks; }
+private:
+	void write(const void* data, size_t size);
+	void read(void* data, size_t size);
+
+	const uint32_t MAGIC = 0x50525043; //"CPRP"
+	const uint16_t VERSION = 2; //2 makes the attack hitboxes with the players, the bodies are in a different order to 1
+
+	uint64_t m_seed;
+	uint64_t m_levelHash;
+	std::vector<Player> m_players;
+	uint32_t m_ticks;
+	std::vector<uint8_t> m_data; //Every tick's entries back to back
+	size_t m_read;
+	uint32_t m_ticksRead;
+};
+
+#endif
@@ -6,8 +6,10 @@
 #include <iostream>
 #include <fstream>
 #include <map>
+#include <tuple>
 #include "../Libraries/SDL_TTF/include/SDL_ttf.h"
 #include "SDL_mixer.h"
+#include "TextureAtlas.h"
 using json = nlohmann::json;
 
 class ResourceHandler
@@ -28,7 +30,8 @@ public:
 	TTF_Font* loadFont(std::string filePath, std::string name);
 	TTF_Font* getFont(std::string name);
 
-	SDL_Texture* getTexture(std::string name);
+	TextureRegion getTexture(std::string name);
+	SDL_Texture* getPlatformTexture(int w, int h, const std::string& tag, const std::string& colour);
 	Mix_Chunk* getSFX(std::string name);
 	Mix_Music* getMusic(std::string name);
 	json& getLevelData() { return m_gameData; }
@@ -37,7 +40,13 @@ private:
 	json m_gameData;
 	json m_achievementData;
 	std::string m_filePath;
-	std::map<std::string, SDL_Texture*> m_map; //Where we will hold the textures
+	void addImage(const std::string& name, const std::string& fileName);
+
+	std::map<std::string, TextureRegion> m_map; //Where we will hold the textures, most of them point into the atlas
+	TextureAtlas m_atlas; //Pages the images are packed into
+	std::vector<SDL_Texture*> m_textures; //Images too big for the atlas
+	SDL_Renderer* m_rendererPtr;
+	std::map<std::tuple<int, int, std::string, std::string>, SDL_Texture*> m_platformTextures; //Built platforms by width, height, tag and colour
 	std::map<std::string, Mix_Chunk*> m_sfx;
 	std::map<std::string, Mix_Music*> m_music;
 
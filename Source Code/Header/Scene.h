@@ -6,12 +6,13 @@
 #include "ResourceManager.h"
 #include "AudioComponent.h"
 #include "AchievementComponent.h"
+#include "SystemRegistry.h"
 
 //Base scene class, this will be inherited by every other scene
 class Scene : public Subject
 {
 public:
-	Scene() { m_stgt = ""; m_cs = false; }
+	Scene() { m_stgt = ""; m_cs = false; m_exit = false; }
 	virtual ~Scene() {}
 	virtual void start() = 0;
 	virtual void stop() = 0;
@@ -26,10 +27,12 @@ public:
 	bool changeScene() { return m_cs; }
 	std::string getNewScene() { return m_stgt; }
 	void resetSceneChange() { m_cs = false; }
+	void exitGame() { m_exit = true; }
+	bool exiting() { return m_exit; }
 	void setResourceHandler(ResourceHandler& resources) { m_resources = &resources; }
-	void setSystemsPtr(std::map<std::string, System*>& map) { m_systems = &map; }
+	void setSystemsPtr(SystemRegistry& systems) { m_systems = &systems; }
 	ResourceHandler& resources() { return *m_resources; }
-	std::map<std::string, System*>& systems() { return *m_systems; };
+	SystemRegistry& systems() { return *m_systems; };
 	std::string getStgt() { return m_stgt; }
 	AudioComponent& audio() { return m_audio; }
 	AchievementComponent& achievements() { return m_achievements; }
@@ -37,7 +40,8 @@ private:
 	AudioComponent m_audio;
 	AchievementComponent m_achievements;
 	ResourceHandler * m_resources;
-	std::map<std::string, System*> * m_systems;
+	SystemRegistry * m_systems;
 	std::string m_stgt;
 	bool m_cs;
+	bool m_exit;
 };
\ No newline at end of file
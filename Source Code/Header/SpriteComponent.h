@@ -4,14 +4,16 @@
 #include <SDL.h>
 #include "PositionComponent.h"
 #include "Vector2f.h"
+#include "TextureRegion.h"
 
 class SpriteComponent : public Component
 {
 public:
 	//Sprite component take sin the position component (where its placed), the overallSize of the sprite
 	//the size of a single frame (this can be the same as overall size if its a 1 frame sprite)
-	//the texture itself and the layer of the sprite
-	SpriteComponent(Component* pos, Vector2f overallSize, Vector2f singleFramebounds, SDL_Texture * texture, int layer = 0):
+	//the texture itself and the layer of the sprite.
+	//Sprites kept by the entity manager have no position pointer, the render system looks the entity's position up
+	SpriteComponent(Component* pos, Vector2f overallSize, Vector2f singleFramebounds, TextureRegion texture, int layer = 0):
 		m_bounds(overallSize),
 		m_angle(0),
 		m_singleFrameBounds(singleFramebounds),
@@ -20,7 +22,9 @@ public:
 		m_posPtr(pos),
 		m_scale(1,1), //Scale is 1, 1, sprite is not flipped
 		m_flip(SDL_FLIP_NONE),
-		m_useCamera(true)
+		m_useCamera(true),
+		m_static(false),
+		m_visible(true)
 	{
 		m_src = { 0, 0, (int)singleFramebounds.x, (int)singleFramebounds.y };
 		m_dst = { 0, 0, (int)singleFramebounds.x, (int)singleFramebounds.y };
@@ -28,7 +32,7 @@ public:
 
 	//Setters
 	void setAngle(float a) { m_angle = a; }
-	void setTexture(SDL_Texture* texture) { m_texture = texture; }
+	void setTexture(TextureRegion texture) { m_texture = texture; }
 	void setTextureRect(SDL_Rect frame) { m_src = frame; }
 	void setScale(float x, float y)
 	{
@@ -48,19 +52,24 @@ public:
 	void setSourceRect(SDL_Rect size) { m_src = size; };
 	void setDestRect(SDL_Rect size) { m_dst = size; }
 	void setPosPtr(Component* pos) { m_posPtr = pos; }
+	void setLayer(int layer) { m_layer = layer; } //The render system picks the change up on its next draw
 
 	//Getters
 	Vector2f& getPosition() { return static_cast<PositionComponent*>(m_posPtr)->position; }
+	Vector2f getDrawPosition(float alpha) { return static_cast<PositionComponent*>(m_posPtr)->drawPosition(alpha); }
 	Vector2f getBounds() { return m_bounds; }
 	Vector2f getFrameSize() { return m_singleFrameBounds; }
 	Vector2f getScale() { return m_scale; }
-	SDL_Texture* getTexture() { return m_texture; }
+	TextureRegion getTexture() { return m_texture; }
 	SDL_Rect getSourceRect() { return m_src; }
+	SDL_Rect getPageRect() { return m_texture.toPage(m_src); } //Source rect on the texture that is actually drawn
 	SDL_Rect getDestRect() { return m_dst; }
 	SDL_RendererFlip& getFlip() { return m_flip; }
 	int getLayer() { return m_layer; }
 	float& getAngle() { return m_angle; }
 	bool& useCamera() { return m_useCamera; }
+	bool& isStatic() { return m_static; } //Set before adding to the render system, static sprites are culled through its grid. Packed sprites are marked by its addStatic
+	bool& isVisible() { return m_visible; } //Hidden sprites are skipped when drawing
 private:
 	Vector2f m_scale;
 	SDL_RendererFlip m_flip;
@@ -68,10 +77,12 @@ private:
 	Vector2f m_bounds, m_singleFrameBounds;
 	SDL_Rect m_src;
 	SDL_Rect m_dst;
-	SDL_Texture * m_texture;
+	TextureRegion m_texture; //May be part of an atlas page, the source rect is relative to the image not the page
 	int m_layer;
 	float m_angle;
 	bool m_useCamera;
+	bool m_static;
+	bool m_visible;
 };
 
 #endif
\ No newline at end of file
@@ -2,9 +2,55 @@
 #define SYSTEM_H
 
 #include <algorithm>
+#include <bitset>
+#include <unordered_map>
 #include "Component.h"
 #include <iostream>
 
+//The component types a system reads and writes, plus any shared resources it touches outside of components.
+//The scheduler lets two systems run at the same time only if neither writes something the other uses
+struct SystemAccess
+{
+	enum Resource
+	{
+		PHYSICS_WORLD = 1 << 0, //Creating, moving or querying Box2D bodies
+		AUDIO = 1 << 1, //Playing sounds
+		RENDER_LIST = 1 << 2, //Adding or removing sprites from the render system
+		ENTITY_COMMANDS = 1 << 3, //Recording into the entity command buffer
+		RANDOM = 1 << 4 //Drawing from the match's random number generator
+	};
+
+	typedef std::bitset<ComponentType::MAX_TYPES> Components;
+
+	SystemAccess() : readResources(0), writeResources(0) {}
+
+	//Access to everything, systems that have not declared anything get this and always run on their own
+	static SystemAccess all()
+	{
+		SystemAccess a;
+		a.reads.set();
+		a.writes.set();
+		a.readResources = a.writeResources = ~0u;
+		return a;
+	}
+
+	template<typename T>
+	SystemAccess& read() { reads.set(ComponentType::id<T>()); return *this; }
+	template<typename T>
+	SystemAccess& write() { writes.set(ComponentType::id<T>()); return *this; }
+	SystemAccess& readResource(unsigned int resources) { readResources |= resources; return *this; }
+	SystemAccess& writeResource(unsigned int resources) { writeResources |= resources; return *this; }
+
+	bool conflicts(const SystemAccess& other) const
+	{
+		return (writes & (other.reads | other.writes)).any() || (other.writes & reads).any() ||
+			(writeResources & (other.readResources | other.writeResources)) || (other.writeResources & readResources);
+	}
+
+	Components reads, writes; //Bit per component type id
+	unsigned int readResources, writeResources;
+};
+
 class System
 {
 public:
@@ -13,18 +59,62 @@ public:
 	virtual void addComponent(Component *) = 0;
 	virtual void update(double dt) = 0;
 
-	//Delect component method
-	void deleteComponent(Component* comp)
+	//What this system touches, override to let the scheduler run it alongside others
+	virtual SystemAccess access() const { return SystemAccess::all(); }
+
+	//Delect component method, swaps the last component into the hole so the list stays packed
+	virtual void deleteComponent(Component* comp)
+	{
+		auto it = m_indexes.find(comp);
+		if (it == m_indexes.end())
+			return;
+
+		auto index = it->second;
+		auto last = m_components.back();
+		m_components[index] = last;
+		m_indexes[last] = index;
+		m_components.pop_back();
+		m_indexes.erase(comp);
+	}
+
+	//Batched versions used by the command buffer, systems that sort or compact can override these to do it once
+	virtual void addComponents(const std::vector<Component*>& comps)
+	{
+		for (auto comp : comps)
+			addComponent(comp);
+	}
+	virtual void deleteComponents(const std::vector<Component*>& comps)
 	{
-		m_components.erase(std::remove(m_components.begin(), m_components.end(), comp), m_components.end());
+		for (auto comp : comps)
+			deleteComponent(comp);
 	}
 
-	void removeAllComponents()
+	virtual void removeAllComponents()
 	{
 		m_components.clear();
+		m_indexes.clear();
 	}
 
 	std::vector<Component *> m_components;
+protected:
+	//Adds the component to the packed list, systems should use this instead of pushing onto m_components
+	void insertComponent(Component* comp)
+	{
+		if (m_indexes.count(comp))
+			return;
+		m_indexes[comp] = m_components.size();
+		m_components.push_back(comp);
+	}
+
+	//Rebuilds the index lookup, needed after a system reorders m_components itself
+	void reindex()
+	{
+		m_indexes.clear();
+		for (size_t i = 0; i < m_components.size(); i++)
+			m_indexes[m_components[i]] = i;
+	}
+
+	std::unordered_map<Component*, size_t> m_indexes; //Where each component sits in m_components
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,53 @@
+#ifndef SYSTEMREGISTRY_H
+#define SYSTEMREGISTRY_H
+
+#include <vector>
+#include "System.h"
+#include "TypeId.h"
+
+//Gives every system class its own index
+typedef TypeId<System> SystemType;
+
+//Holds one of each system, looked up by type eg. registry.get<AnimationSystem>().
+//The registry owns the systems it is given and deletes them when it goes
+class SystemRegistry
+{
+public:
+	SystemRegistry() {}
+	~SystemRegistry()
+	{
+		for (auto system : m_systems)
+			delete system;
+	}
+
+	//Adds the system, replacing (and deleting) any system of the same type that was there before
+	template<typename T>
+	T* add(T* system)
+	{
+		auto id = SystemType::id<T>();
+		if (id >= (int)m_systems.size())
+			m_systems.resize(id + 1, nullptr);
+
+		if (m_systems[id] != system)
+			delete m_systems[id];
+		m_systems[id] = system;
+		return system;
+	}
+
+	//Returns nullptr if no system of that type has been added
+	template<typename T>
+	T* get() const
+	{
+		auto id = SystemType::id<T>();
+		if (id >= (int)m_systems.size())
+			return nullptr;
+		return static_cast<T*>(m_systems[id]);
+	}
+private:
+	SystemRegistry(const SystemRegistry&) = delete;
+	SystemRegistry& operator=(const SystemRegistry&) = delete;
+
+	std::vector<System*> m_systems; //Indexed by SystemType::id
+};
+
+#endif
@@ -0,0 +1,45 @@
+#ifndef SYSTEMSCHEDULER_H
+#define SYSTEMSCHEDULER_H
+
+#include <string>
+#include <vector>
+#include "System.h"
+#include "WorkerPool.h"
+
+//Runs a list of systems each frame. Systems are split into waves using their declared access, a system goes in
+//the wave after the last earlier system it conflicts with. Systems in the same wave touch nothing in common so they
+//run at the same time on the worker pool, and the end result is the same as running them one after the other
+class SystemScheduler
+{
+public:
+	SystemScheduler(WorkerPool* workers = nullptr);
+
+	//Systems are added in the order they would run serially, scaled systems get dt multiplied by the time scale.
+	//The name is the profiler zone the system's update is timed under
+	void add(System* system, const std::string& name, bool scaled = true);
+	void clear();
+	void run(double dt, float timeScale);
+
+	//Whether each system's update is timed under its profiler zone, on by default
+	void setProfiled(bool profiled) { m_profiled = profiled; }
+
+	const std::vector<std::vector<int>>& waves();
+private:
+	void build();
+
+	struct Entry
+	{
+		System* system;
+		bool scaled;
+		int zone;
+	};
+	void runEntry(const Entry& entry, double dt, float timeScale);
+
+	WorkerPool* m_workersPtr;
+	std::vector<Entry> m_entries;
+	std::vector<std::vector<int>> m_waves; //Indexes into m_entries
+	bool m_built;
+	bool m_profiled;
+};
+
+#endif
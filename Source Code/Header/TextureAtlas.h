@@ -0,0 +1,44 @@
+#ifndef TEXTUREATLAS_H
+#define TEXTUREATLAS_H
+
+#include <map>
+#include <string>
+#include <vector>
+#include "SDL.h"
+#include "TextureRegion.h"
+
+//Packs loaded images into a few large page textures when the game starts.
+//Images are added as surfaces, build() packs them onto pages in shelves (tallest first),
+//uploads each page once and frees the surfaces. Images bigger than a page are left out and add() returns false
+class TextureAtlas
+{
+public:
+	TextureAtlas(int pageSize = 4096, int padding = 1);
+	~TextureAtlas();
+
+	bool add(const std::string& name, SDL_Surface* surface);
+	void build(SDL_Renderer& renderer);
+	void destroy();
+
+	const std::map<std::string, TextureRegion>& regions() const { return m_regions; }
+	int pageCount() const { return m_pages.size(); }
+	int pageSize() const { return m_pageSize; }
+	void setPageSize(int size) { m_pageSize = size; }
+private:
+	TextureAtlas(const TextureAtlas&) = delete;
+	TextureAtlas& operator=(const TextureAtlas&) = delete;
+
+	struct Pending
+	{
+		std::string name;
+		SDL_Surface* surface;
+	};
+
+	int m_pageSize;
+	int m_padding; //Empty pixels between images so filtering doesn't bleed the neighbour in
+	std::vector<Pending> m_pending; //Added but not packed yet
+	std::vector<SDL_Texture*> m_pages;
+	std::map<std::string, TextureRegion> m_regions;
+};
+
+#endif
@@ -0,0 +1,37 @@
+#ifndef TEXTUREREGION_H
+#define TEXTUREREGION_H
+
+#include "SDL.h"
+
+//A picture inside a texture. Images packed into an atlas share a page texture and each get their own rect on it.
+//Converts from a plain texture so text and render target textures still work, they use the whole texture
+struct TextureRegion
+{
+	TextureRegion(SDL_Texture* tex = nullptr) :
+		texture(tex),
+		rect({ 0, 0, 0, 0 })
+	{}
+	TextureRegion(SDL_Texture* tex, SDL_Rect r) :
+		texture(tex),
+		rect(r)
+	{}
+
+	//Moves a rect in image space onto the page
+	SDL_Rect toPage(SDL_Rect local) const
+	{
+		local.x += rect.x;
+		local.y += rect.y;
+		return local;
+	}
+
+	bool operator==(const TextureRegion& other) const
+	{
+		return texture == other.texture && rect.x == other.rect.x && rect.y == other.rect.y;
+	}
+	bool operator!=(const TextureRegion& other) const { return !(*this == other); }
+
+	SDL_Texture* texture; //The page, or the whole texture when it isn't in an atlas
+	SDL_Rect rect; //Where the image sits on the page, zero sized if it isn't in an atlas
+};
+
+#endif
@@ -0,0 +1,26 @@
+#ifndef TYPEID_H
+#define TYPEID_H
+
+#include <atomic>
+
+//Gives every class in a family its own index, counting up from 0 in the order the classes are first asked about.
+//The index is worked out once per type, eg. TypeId<System>::id<AnimationSystem>(). Each family counts on its own
+template<typename Family>
+class TypeId
+{
+public:
+	template<typename T>
+	static int id()
+	{
+		static const int typeId = counter()++;
+		return typeId;
+	}
+private:
+	static std::atomic<int>& counter()
+	{
+		static std::atomic<int> count(0);
+		return count;
+	}
+};
+
+#endif
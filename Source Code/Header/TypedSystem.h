@@ -0,0 +1,52 @@
+#ifndef TYPEDSYSTEM_H
+#define TYPEDSYSTEM_H
+
+#include "System.h"
+
+//A system that only ever holds one type of component. The component is cast once when it is added
+//so update loops work on T* directly instead of casting every component every frame
+template<typename T>
+class TypedSystem : public System
+{
+public:
+	//Delect component method, swaps the last component into the hole so the list stays packed
+	void deleteComponent(Component* comp) override
+	{
+		auto it = m_indexes.find(comp);
+		if (it == m_indexes.end())
+			return;
+
+		auto index = it->second;
+		auto last = m_items.back();
+		m_items[index] = last;
+		m_indexes[last] = index;
+		m_items.pop_back();
+		m_indexes.erase(comp);
+	}
+
+	void removeAllComponents() override
+	{
+		m_items.clear();
+		m_indexes.clear();
+	}
+
+	std::vector<T*> m_items; //The components of this system, m_components is not used by typed systems
+protected:
+	//Adds the component to the packed list, hides System::insertComponent so derived systems keep calling the same name
+	void insertComponent(Component* comp)
+	{
+		if (m_indexes.count(comp))
+			return;
+		m_indexes[comp] = m_items.size();
+		m_items.push_back(static_cast<T*>(comp));
+	}
+
+	void reindex()
+	{
+		m_indexes.clear();
+		for (size_t i = 0; i < m_items.size(); i++)
+			m_indexes[m_items[i]] = i;
+	}
+};
+
+#endif
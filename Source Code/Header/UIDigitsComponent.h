@@ -0,0 +1,50 @@
+#pragma once
+#include "Component.h"
+#include "SpriteComponent.h"
+
+//The damage and super digits of a player's ui. Remembers the values on screen so the
+//sprites are only touched when a number changes
+class UIDigitsComponent : public Component
+{
+public:
+	static const int DIGITS = 3;
+	static const int DIGIT_SIZE = 32; //Width and height of one digit in the numbers texture
+
+	UIDigitsComponent() :
+		m_shownDamage(-1),
+		m_shownSuper(-1)
+	{
+		for (int i = 0; i < DIGITS; i++)
+		{
+			m_damage[i] = nullptr;
+			m_super[i] = nullptr;
+		}
+	}
+
+	//Shows the value if it is different to the one on screen, values over 999 show as 999
+	static void show(SpriteComponent* (&digits)[DIGITS], int& shown, int value)
+	{
+		if (value < 0)
+			value = 0;
+		if (value > 999)
+			value = 999;
+		if (value == shown)
+			return;
+		shown = value;
+
+		//Right most digit first
+		for (int i = DIGITS - 1; i >= 0; i--)
+		{
+			digits[i]->setTextureRect({ DIGIT_SIZE * (value % 10), 0, DIGIT_SIZE, DIGIT_SIZE });
+			value /= 10;
+		}
+	}
+
+	void showDamage(int value) { show(m_damage, m_shownDamage, value); }
+	void showSuper(int value) { show(m_super, m_shownSuper, value); }
+
+	SpriteComponent* m_damage[DIGITS];
+	SpriteComponent* m_super[DIGITS];
+private:
+	int m_shownDamage, m_shownSuper; //-1 until something has been shown
+};
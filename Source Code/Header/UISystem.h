@@ -1,13 +1,25 @@
 #pragma once
 #include "System.h"
-#include "Entity.h"
+#include "EntityManager.h"
+
+class PlayerPhysicsComponent;
+class PlayerComponent;
+class UIDigitsComponent;
+class SpriteComponent;
 
 class UISystem : public System
 {
 public:
-	UISystem(std::map<Entity*, Entity*>* uimap);
+	UISystem(std::map<EntityHandle, Entity*>* uimap, EntityManager* entities);
 	void addComponent(Component* c);
 	void update(double dt);
+
+	//Drains the super meter as well as drawing it, so it writes to the players. It runs on real time, not slow motion
+	SystemAccess access() const override
+	{
+		return SystemAccess().write<PlayerPhysicsComponent>().write<PlayerComponent>().write<UIDigitsComponent>().write<SpriteComponent>();
+	}
 private:
-	std::map<Entity*, Entity*>* m_map;
+	std::map<EntityHandle, Entity*>* m_map;
+	EntityManager* m_entitiesPtr;
 };
\ No newline at end of file
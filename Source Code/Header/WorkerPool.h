@@ -0,0 +1,57 @@
+#ifndef WORKERPOOL_H
+#define WORKERPOOL_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+//A fixed set of worker threads that run queued jobs. wait() blocks until every job queued so far has finished.
+//Callers sharing a pool push their jobs under a Group and wait on that instead, so nobody waits on another caller's jobs
+class WorkerPool
+{
+public:
+	//Counts the jobs pushed under it that haven't finished, only touched with the pool's lock held
+	class Group
+	{
+	public:
+		Group() : m_running(0) {}
+	private:
+		friend class WorkerPool;
+		unsigned int m_running;
+	};
+
+	WorkerPool(unsigned int workers);
+	~WorkerPool();
+
+	void push(std::function<void()> job);
+	void push(std::function<void()> job, Group& group);
+	void wait();
+	//Blocks until the group's jobs are done, running any of them the workers haven't started yet on this thread
+	void wait(Group& group);
+
+	unsigned int size() const { return m_threads.size(); }
+private:
+	WorkerPool(const WorkerPool&) = delete;
+	WorkerPool& operator=(const WorkerPool&) = delete;
+
+	struct Job
+	{
+		std::function<void()> run;
+		Group* group; //nullptr if it was pushed without one
+	};
+
+	void work();
+	void finished(Group* group); //Call with the lock held
+
+	std::vector<std::thread> m_threads;
+	std::deque<Job> m_jobs;
+	std::mutex m_mutex;
+	std::condition_variable m_jobAdded, m_jobsDone;
+	unsigned int m_running; //Jobs queued or being run
+	bool m_stop;
+};
+
+#endif
@@ -150,31 +150,35 @@ b2Island::b2Island(
 	int32 contactCapacity,
 	int32 jointCapacity,
 	b2StackAllocator* allocator,
-	b2ContactListener* listener)
+	b2ContactListener* listener,
+	int32 staticCapacity)
 {
 	m_bodyCapacity = bodyCapacity;
 	m_contactCapacity = contactCapacity;
 	m_jointCapacity	 = jointCapacity;
+	m_staticCapacity = staticCapacity;
 	m_bodyCount = 0;
 	m_contactCount = 0;
 	m_jointCount = 0;
 
 	m_allocator = allocator;
 	m_listener = listener;
+	m_impulses = NULL;
 
 	m_bodies = (b2Body**)m_allocator->Allocate(bodyCapacity * sizeof(b2Body*));
 	m_contacts = (b2Contact**)m_allocator->Allocate(contactCapacity	 * sizeof(b2Contact*));
 	m_joints = (b2Joint**)m_allocator->Allocate(jointCapacity * sizeof(b2Joint*));
 
-	m_velocities = (b2Velocity*)m_allocator->Allocate(m_bodyCapacity * sizeof(b2Velocity));
-	m_positions = (b2Position*)m_allocator->Allocate(m_bodyCapacity * sizeof(b2Position));
+	// The static slots go in front of the bodies.
+	m_velocities = (b2Velocity*)m_allocator->Allocate((m_staticCapacity + m_bodyCapacity) * sizeof(b2Velocity)) + m_staticCapacity;
+	m_positions = (b2Position*)m_allocator->Allocate((m_staticCapacity + m_bodyCapacity) * sizeof(b2Position)) + m_staticCapacity;
 }
 
 b2Island::~b2Island()
 {
 	// Warning: the order should reverse the constructor order.
-	m_allocator->Free(m_positions);
-	m_allocator->Free(m_velocities);
+	m_allocator->Free(m_positions - m_staticCapacity);
+	m_allocator->Free(m_velocities - m_staticCapacity);
 	m_allocator->Free(m_joints);
 	m_allocator->Free(m_contacts);
 	m_allocator->Free(m_bodies);
@@ -513,9 +517,43 @@ void b2Island::SolveTOI(const b2TimeStep& subStep, int32 toiIndexA, int32 toiInd
 	Report(contactSolver.m_velocityConstraints);
 }
 
+void b2Island::AddStatics()
+{
+	for (int32 i = 0; i < m_contactCount + m_jointCount; ++i)
+	{
+		b2Body* bodies[2];
+		if (i < m_contactCount)
+		{
+			bodies[0] = m_contacts[i]->GetFixtureA()->GetBody();
+			bodies[1] = m_contacts[i]->GetFixtureB()->GetBody();
+		}
+		else
+		{
+			bodies[0] = m_joints[i - m_contactCount]->GetBodyA();
+			bodies[1] = m_joints[i - m_contactCount]->GetBodyB();
+		}
+
+		for (int32 j = 0; j < 2; ++j)
+		{
+			b2Body* b = bodies[j];
+			if (b->GetType() != b2_staticBody)
+			{
+				continue;
+			}
+
+			int32 index = b->m_islandIndex;
+			b2Assert(-m_staticCapacity <= index && index < 0);
+			m_positions[index].c = b->m_sweep.c;
+			m_positions[index].a = b->m_sweep.a;
+			m_velocities[index].v = b->m_linearVelocity;
+			m_velocities[index].w = b->m_angularVelocity;
+		}
+	}
+}
+
 void b2Island::Report(const b2ContactVelocityConstraint* constraints)
 {
-	if (m_listener == NULL)
+	if (m_listener == NULL && m_impulses == NULL)
 	{
 		return;
 	}
@@ -534,6 +572,13 @@ void b2Island::Report(const b2ContactVelocityConstraint* constraints)
 			impulse.tangentImpulses[j] = vc->points[j].tangentImpulse;
 		}
 
-		m_listener->PostSolve(c, &impulse);
+		if (m_impulses)
+		{
+			m_impulses[i] = impulse;
+		}
+		else
+		{
+			m_listener->PostSolve(c, &impulse);
+		}
 	}
 }
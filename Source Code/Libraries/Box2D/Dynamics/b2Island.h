@@ -27,6 +27,7 @@ class b2Contact;
 class b2Joint;
 class b2StackAllocator;
 class b2ContactListener;
+struct b2ContactImpulse;
 struct b2ContactVelocityConstraint;
 struct b2Profile;
 
@@ -35,7 +36,7 @@ class b2Island
 {
 public:
 	b2Island(int32 bodyCapacity, int32 contactCapacity, int32 jointCapacity,
-			b2StackAllocator* allocator, b2ContactListener* listener);
+			b2StackAllocator* allocator, b2ContactListener* listener, int32 staticCapacity = 0);
 	~b2Island();
 
 	void Clear()
@@ -71,9 +72,17 @@ public:
 
 	void Report(const b2ContactVelocityConstraint* constraints);
 
+	/// Islands solved at the same time can share static bodies, so static bodies are not added.
+	/// Instead each one has a slot below zero, m_islandIndex = -1 - n, set by the world.
+	/// This copies the static bodies used by the island's constraints into their slots.
+	void AddStatics();
+
 	b2StackAllocator* m_allocator;
 	b2ContactListener* m_listener;
 
+	// If set, Report stores each contact's impulse here for the world to report later instead of calling the listener.
+	b2ContactImpulse* m_impulses;
+
 	b2Body** m_bodies;
 	b2Contact** m_contacts;
 	b2Joint** m_joints;
@@ -88,6 +97,7 @@ public:
 	int32 m_bodyCapacity;
 	int32 m_contactCapacity;
 	int32 m_jointCapacity;
+	int32 m_staticCapacity;
 };
 
 #endif
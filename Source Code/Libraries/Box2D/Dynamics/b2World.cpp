@@ -61,6 +61,10 @@ b2World::b2World(const b2Vec2& gravity)
 	m_contactManager.m_allocator = &m_blockAllocator;
 
 	memset(&m_profile, 0, sizeof(b2Profile));
+
+	m_taskPool = NULL;
+	m_workerAllocators = NULL;
+	m_workerCount = 0;
 }
 
 b2World::~b2World()
@@ -82,6 +86,8 @@ b2World::~b2World()
 
 		b = bNext;
 	}
+
+	SetTaskPool(NULL);
 }
 
 void b2World::SetDestructionListener(b2DestructionListener* listener)
@@ -99,6 +105,30 @@ void b2World::SetContactListener(b2ContactListener* listener)
 	m_contactManager.m_contactListener = listener;
 }
 
+void b2World::SetTaskPool(b2TaskPool* pool)
+{
+	b2Assert(IsLocked() == false);
+
+	for (int32 i = 0; i < m_workerCount; ++i)
+	{
+		m_workerAllocators[i].~b2StackAllocator();
+	}
+	b2Free(m_workerAllocators);
+	m_workerAllocators = NULL;
+	m_workerCount = 0;
+
+	m_taskPool = pool;
+	if (m_taskPool)
+	{
+		m_workerCount = b2Max(m_taskPool->GetWorkerCount(), 1);
+		m_workerAllocators = (b2StackAllocator*)b2Alloc(m_workerCount * sizeof(b2StackAllocator));
+		for (int32 i = 0; i < m_workerCount; ++i)
+		{
+			new (m_workerAllocators + i) b2StackAllocator();
+		}
+	}
+}
+
 void b2World::SetDebugDraw(b2Draw* debugDraw)
 {
 	g_debugDraw = debugDraw;
@@ -547,6 +577,319 @@ void b2World::Solve(const b2TimeStep& step)
 
 	m_stackAllocator.Free(stack);
 
+	FinishSolve();
+}
+
+// The bodies, contacts and joints of one island, as ranges of the arrays gathered by SolveParallel.
+struct b2IslandRange
+{
+	int32 bodyStart, bodyCount;
+	int32 contactStart, contactCount;
+	int32 jointStart, jointCount;
+};
+
+// Solves a run of islands with one worker's stack allocator.
+class b2IslandSolveTask : public b2Task
+{
+public:
+	void Execute(int32 index)
+	{
+		b2Profile* profile = profiles + index;
+		profile->solveInit = 0.0f;
+		profile->solveVelocity = 0.0f;
+		profile->solvePosition = 0.0f;
+
+		for (int32 i = firstIsland[index]; i < firstIsland[index + 1]; ++i)
+		{
+			const b2IslandRange& range = islands[i];
+
+			// Post-solve callbacks are left to the world, so no listener.
+			b2Island island(range.bodyCount, range.contactCount, range.jointCount, allocators + index, NULL, staticCount);
+			for (int32 j = 0; j < range.bodyCount; ++j)
+			{
+				island.Add(bodies[range.bodyStart + j]);
+			}
+			for (int32 j = 0; j < range.contactCount; ++j)
+			{
+				island.Add(contacts[range.contactStart + j]);
+			}
+			for (int32 j = 0; j < range.jointCount; ++j)
+			{
+				island.Add(joints[range.jointStart + j]);
+			}
+			island.AddStatics();
+			if (impulses)
+			{
+				island.m_impulses = impulses + range.contactStart;
+			}
+
+			b2Profile islandProfile;
+			island.Solve(&islandProfile, *step, gravity, allowSleep);
+			profile->solveInit += islandProfile.solveInit;
+			profile->solveVelocity += islandProfile.solveVelocity;
+			profile->solvePosition += islandProfile.solvePosition;
+		}
+	}
+
+	const b2TimeStep* step;
+	b2Vec2 gravity;
+	bool allowSleep;
+	int32 staticCount;
+
+	b2Body** bodies;
+	b2Contact** contacts;
+	b2Joint** joints;
+	const b2IslandRange* islands;
+	const int32* firstIsland; // The islands for task i are [firstIsland[i], firstIsland[i + 1])
+	b2ContactImpulse* impulses; // Filled in the same order as contacts, NULL if there is no listener
+
+	b2StackAllocator* allocators;
+	b2Profile* profiles;
+};
+
+// Same as Solve, but all the islands are found first and then split between the task pool's workers.
+// Islands don't share any dynamic bodies, contacts or joints, so they can be solved at the same time.
+// Static bodies can be in many islands, so they aren't added to islands, see b2Island::AddStatics.
+void b2World::SolveParallel(const b2TimeStep& step)
+{
+	m_profile.solveInit = 0.0f;
+	m_profile.solveVelocity = 0.0f;
+	m_profile.solvePosition = 0.0f;
+
+	// Clear all the island flags and give each static body its slot.
+	int32 staticCount = 0;
+	for (b2Body* b = m_bodyList; b; b = b->m_next)
+	{
+		b->m_flags &= ~b2Body::e_islandFlag;
+		if (b->GetType() == b2_staticBody)
+		{
+			b->m_islandIndex = -1 - staticCount;
+			++staticCount;
+		}
+	}
+	for (b2Contact* c = m_contactManager.m_contactList; c; c = c->m_next)
+	{
+		c->m_flags &= ~b2Contact::e_islandFlag;
+	}
+	for (b2Joint* j = m_jointList; j; j = j->m_next)
+	{
+		j->m_islandFlag = false;
+	}
+
+	b2Body** bodies = (b2Body**)m_stackAllocator.Allocate(m_bodyCount * sizeof(b2Body*));
+	b2Contact** contacts = (b2Contact**)m_stackAllocator.Allocate(m_contactManager.m_contactCount * sizeof(b2Contact*));
+	b2Joint** joints = (b2Joint**)m_stackAllocator.Allocate(m_jointCount * sizeof(b2Joint*));
+	b2IslandRange* islands = (b2IslandRange*)m_stackAllocator.Allocate(m_bodyCount * sizeof(b2IslandRange));
+	int32 bodyCount = 0;
+	int32 contactCount = 0;
+	int32 jointCount = 0;
+	int32 islandCount = 0;
+
+	// Find all awake islands, in the same order and with the same contents as Solve.
+	int32 stackSize = m_bodyCount;
+	b2Body** stack = (b2Body**)m_stackAllocator.Allocate(stackSize * sizeof(b2Body*));
+	for (b2Body* seed = m_bodyList; seed; seed = seed->m_next)
+	{
+		if (seed->m_flags & b2Body::e_islandFlag)
+		{
+			continue;
+		}
+
+		if (seed->IsAwake() == false || seed->IsActive() == false)
+		{
+			continue;
+		}
+
+		// The seed can be dynamic or kinematic.
+		if (seed->GetType() == b2_staticBody)
+		{
+			continue;
+		}
+
+		b2IslandRange* island = islands + islandCount++;
+		island->bodyStart = bodyCount;
+		island->contactStart = contactCount;
+		island->jointStart = jointCount;
+
+		int32 stackCount = 0;
+		stack[stackCount++] = seed;
+		seed->m_flags |= b2Body::e_islandFlag;
+
+		// Perform a depth first search (DFS) on the constraint graph.
+		while (stackCount > 0)
+		{
+			b2Body* b = stack[--stackCount];
+			b2Assert(b->IsActive() == true);
+			bodies[bodyCount++] = b;
+
+			// Make sure the body is awake.
+			b->SetAwake(true);
+
+			// Search all contacts connected to this body.
+			for (b2ContactEdge* ce = b->m_contactList; ce; ce = ce->next)
+			{
+				b2Contact* contact = ce->contact;
+
+				// Has this contact already been added to an island?
+				if (contact->m_flags & b2Contact::e_islandFlag)
+				{
+					continue;
+				}
+
+				// Is this contact solid and touching?
+				if (contact->IsEnabled() == false ||
+					contact->IsTouching() == false)
+				{
+					continue;
+				}
+
+				// Skip sensors.
+				bool sensorA = contact->m_fixtureA->m_isSensor;
+				bool sensorB = contact->m_fixtureB->m_isSensor;
+				if (sensorA || sensorB)
+				{
+					continue;
+				}
+
+				contacts[contactCount++] = contact;
+				contact->m_flags |= b2Contact::e_islandFlag;
+
+				// Static bodies keep their slot and don't propagate the island.
+				b2Body* other = ce->other;
+				if ((other->m_flags & b2Body::e_islandFlag) || other->GetType() == b2_staticBody)
+				{
+					continue;
+				}
+
+				b2Assert(stackCount < stackSize);
+				stack[stackCount++] = other;
+				other->m_flags |= b2Body::e_islandFlag;
+			}
+
+			// Search all joints connect to this body.
+			for (b2JointEdge* je = b->m_jointList; je; je = je->next)
+			{
+				if (je->joint->m_islandFlag == true)
+				{
+					continue;
+				}
+
+				b2Body* other = je->other;
+
+				// Don't simulate joints connected to inactive bodies.
+				if (other->IsActive() == false)
+				{
+					continue;
+				}
+
+				joints[jointCount++] = je->joint;
+				je->joint->m_islandFlag = true;
+
+				if ((other->m_flags & b2Body::e_islandFlag) || other->GetType() == b2_staticBody)
+				{
+					continue;
+				}
+
+				b2Assert(stackCount < stackSize);
+				stack[stackCount++] = other;
+				other->m_flags |= b2Body::e_islandFlag;
+			}
+		}
+
+		island->bodyCount = bodyCount - island->bodyStart;
+		island->contactCount = contactCount - island->contactStart;
+		island->jointCount = jointCount - island->jointStart;
+	}
+
+	m_stackAllocator.Free(stack);
+
+	// The impulses are kept until every island is solved, so post-solve callbacks can be made from this thread.
+	b2ContactListener* listener = m_contactManager.m_contactListener;
+	b2ContactImpulse* impulses = NULL;
+	if (listener)
+	{
+		impulses = (b2ContactImpulse*)m_stackAllocator.Allocate(contactCount * sizeof(b2ContactImpulse));
+	}
+
+	if (islandCount > 0)
+	{
+		// Split the islands into runs of about the same size, one per task, keeping them in order.
+		int32 taskCount = b2Min(m_workerCount, islandCount);
+		int32* firstIsland = (int32*)m_stackAllocator.Allocate((taskCount + 1) * sizeof(int32));
+		int32 totalWeight = bodyCount + contactCount + jointCount;
+		int32 weight = 0;
+		int32 task = 0;
+		firstIsland[0] = 0;
+		for (int32 i = 0; i < islandCount && task + 1 < taskCount; ++i)
+		{
+			weight += islands[i].bodyCount + islands[i].contactCount + islands[i].jointCount;
+
+			// Leave at least one island for each task still to come.
+			if (weight * taskCount >= totalWeight * (task + 1) || islandCount - (i + 1) == taskCount - (task + 1))
+			{
+				firstIsland[++task] = i + 1;
+			}
+		}
+		firstIsland[taskCount] = islandCount;
+
+		b2Profile* profiles = (b2Profile*)m_stackAllocator.Allocate(taskCount * sizeof(b2Profile));
+
+		b2IslandSolveTask solveTask;
+		solveTask.step = &step;
+		solveTask.gravity = m_gravity;
+		solveTask.allowSleep = m_allowSleep;
+		solveTask.staticCount = staticCount;
+		solveTask.bodies = bodies;
+		solveTask.contacts = contacts;
+		solveTask.joints = joints;
+		solveTask.islands = islands;
+		solveTask.firstIsland = firstIsland;
+		solveTask.allocators = m_workerAllocators;
+		solveTask.profiles = profiles;
+		solveTask.impulses = impulses;
+
+		if (taskCount == 1)
+		{
+			solveTask.Execute(0);
+		}
+		else
+		{
+			m_taskPool->Run(&solveTask, taskCount);
+		}
+
+		for (int32 i = 0; i < taskCount; ++i)
+		{
+			m_profile.solveInit += profiles[i].solveInit;
+			m_profile.solveVelocity += profiles[i].solveVelocity;
+			m_profile.solvePosition += profiles[i].solvePosition;
+		}
+
+		m_stackAllocator.Free(profiles);
+		m_stackAllocator.Free(firstIsland);
+	}
+
+	// Report the impulses in the same order Solve would have.
+	if (listener)
+	{
+		for (int32 i = 0; i < contactCount; ++i)
+		{
+			listener->PostSolve(contacts[i], impulses + i);
+		}
+
+		m_stackAllocator.Free(impulses);
+	}
+
+	m_stackAllocator.Free(islands);
+	m_stackAllocator.Free(joints);
+	m_stackAllocator.Free(contacts);
+	m_stackAllocator.Free(bodies);
+
+	FinishSolve();
+}
+
+// Synchronize the fixtures of the bodies that moved and find new contacts.
+void b2World::FinishSolve()
+{
 	{
 		b2Timer timer;
 		// Synchronize fixtures, check for out of range bodies.
@@ -935,7 +1278,14 @@ void b2World::Step(float32 dt, int32 velocityIterations, int32 positionIteration
 	if (m_stepComplete && step.dt > 0.0f)
 	{
 		b2Timer timer;
-		Solve(step);
+		if (m_taskPool)
+		{
+			SolveParallel(step);
+		}
+		else
+		{
+			Solve(step);
+		}
 		m_profile.solve = timer.GetMilliseconds();
 	}
 
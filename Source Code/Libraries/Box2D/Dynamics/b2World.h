@@ -61,6 +61,11 @@ public:
 	/// remain in scope.
 	void SetContactListener(b2ContactListener* listener);
 
+	/// Register a task pool to solve independent islands in parallel. The pool is owned by you
+	/// and must remain in scope. Pass NULL to go back to solving islands one after another.
+	/// Post-solve callbacks are still made on the calling thread, in the same order as without a pool.
+	void SetTaskPool(b2TaskPool* pool);
+
 	/// Register a routine for debug drawing. The debug draw functions are called
 	/// inside with b2World::DrawDebugData method. The debug draw object is owned
 	/// by you and must remain in scope.
@@ -225,6 +230,8 @@ private:
 	friend class b2Controller;
 
 	void Solve(const b2TimeStep& step);
+	void SolveParallel(const b2TimeStep& step);
+	void FinishSolve();
 	void SolveTOI(const b2TimeStep& step);
 
 	void DrawJoint(b2Joint* joint);
@@ -261,6 +268,11 @@ private:
 	bool m_stepComplete;
 
 	b2Profile m_profile;
+
+	// Used by SolveParallel, one stack allocator per worker.
+	b2TaskPool* m_taskPool;
+	b2StackAllocator* m_workerAllocators;
+	int32 m_workerCount;
 };
 
 inline b2Body* b2World::GetBodyList()
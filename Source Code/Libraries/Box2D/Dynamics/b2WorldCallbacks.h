@@ -152,4 +152,29 @@ public:
 									const b2Vec2& normal, float32 fraction) = 0;
 };
 
+/// A piece of work the world wants run, see b2TaskPool.
+class b2Task
+{
+public:
+	virtual ~b2Task() {}
+
+	/// Do the work for one index. Different indices may run at the same time on different threads.
+	virtual void Execute(int32 index) = 0;
+};
+
+/// Implement this to let the world solve independent islands on your own threads.
+/// See b2World::SetTaskPool
+class b2TaskPool
+{
+public:
+	virtual ~b2TaskPool() {}
+
+	/// How many tasks the island solve is split into, usually the number of threads.
+	virtual int32 GetWorkerCount() const = 0;
+
+	/// Call task->Execute(i) for every i in [0, count) and return once all of them have finished.
+	/// count is never more than GetWorkerCount().
+	virtual void Run(b2Task* task, int32 count) = 0;
+};
+
 #endif
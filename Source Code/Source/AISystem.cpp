@@ -7,8 +7,12 @@
 /// <param name="c"></param>
 void AISystem::addComponent(Component * c)
 {
-	m_components.push_back(c);
-	createTree();
+	//Only build the tree for a component we have not seen yet, the others already have theirs
+	if (m_indexes.count(c) == 0)
+	{
+		insertComponent(c);
+		createTree(m_items.back());
+	}
 }
 
 /// <summary>
@@ -16,35 +20,31 @@ void AISystem::addComponent(Component * c)
 /// tree using root, decorator,
 /// and leaf nodes
 /// </summary>
-void AISystem::createTree()
+void AISystem::createTree(AIComponent* cast_comp)
 {
-	for (auto c : m_components)
-	{
-		auto cast_comp = dynamic_cast<AIComponent *>(c);
-
-		auto e = cast_comp->m_self;
+	auto e = cast_comp->m_self;
 
-		auto input = dynamic_cast<AiInputComponent *>(cast_comp->m_input);
-		
-		//Set Behaviour Tree Root node
-		//cast_comp->BT.setRootChild(&cast_comp->m_sequences[0]);
-		cast_comp->BT.setRootChild(&cast_comp->m_selectors[0]);
+	auto input = cast_comp->m_input;
+	
+	//Set Behaviour Tree Root node
+	//cast_comp->BT.setRootChild(&cast_comp->m_sequences[0]);
+	cast_comp->BT.setRootChild(&cast_comp->m_selectors[0]);
 
-		//Left sub tree
-		cast_comp->m_selectors[0].addChildren({&cast_comp->m_sequences[0], &cast_comp->m_selectors[5]});
-		cast_comp->m_sequences[0].addChildren({ new DJAction(e, input), new CheckNearest(cast_comp->m_entities, e, input), new CloseEnough(e, input),
-			&cast_comp->m_succeeders[0], &cast_comp->m_selectors[1], &cast_comp->punchSequence});
-		cast_comp->m_succeeders[0].setChild(new CheckPlayerDirection(e, input));
-		cast_comp->m_selectors[1].addChildren({ new CheckHealth(e, input), &cast_comp->m_selectors[2] });
-		cast_comp->m_selectors[2].addChildren({ new PunchAction(e, input), new FleeAction(e, input) });
-		cast_comp->punchSequence.addChildren({ new CheckAbove(e, input), &cast_comp->m_random });
-		cast_comp->m_random.addChildren({ new PunchAction(e, input), new KickAction(e, input) });
+	//Left sub tree
+	cast_comp->m_selectors[0].addChildren({&cast_comp->m_sequences[0], &cast_comp->m_selectors[5]});
+	cast_comp->m_sequences[0].addChildren({ cast_comp->own(new DJAction(e, input)), cast_comp->own(new CheckNearest(cast_comp->m_entities, e, input)), cast_comp->own(new CloseEnough(e, input)),
+		&cast_comp->m_succeeders[0], &cast_comp->m_selectors[1], &cast_comp->punchSequence});
+	cast_comp->m_succeeders[0].setChild(cast_comp->own(new CheckPlayerDirection(e, input)));
+	cast_comp->m_selectors[1].addChildren({ cast_comp->own(new CheckHealth(e, input)), &cast_comp->m_selectors[2] });
+	cast_comp->m_selectors[2].addChildren({ cast_comp->own(new PunchAction(e, input)), cast_comp->own(new FleeAction(e, input)) });
+	cast_comp->punchSequence.addChildren({ cast_comp->own(new CheckAbove(e, input)), &cast_comp->m_random });
+	cast_comp->m_random.addChildren({ cast_comp->own(new PunchAction(e, input)), cast_comp->own(new KickAction(e, input)) });
+	cast_comp->m_random.setRandom(&cast_comp->m_player->random());
 
-		//Right sub tree
-		cast_comp->m_selectors[5].addChildren({ &cast_comp->m_sequences[1], &cast_comp->m_sequences[2] });
-		cast_comp->m_sequences[1].addChildren({new CheckNearest(cast_comp->m_entities, cast_comp->m_self, input), new CloseEnough(e, input) });
-		cast_comp->m_sequences[2].addChildren({new CheckAbove(e, input), new MoveToPlayer(e, input) });
-	}
+	//Right sub tree
+	cast_comp->m_selectors[5].addChildren({ &cast_comp->m_sequences[1], &cast_comp->m_sequences[2] });
+	cast_comp->m_sequences[1].addChildren({cast_comp->own(new CheckNearest(cast_comp->m_entities, cast_comp->m_self, input)), cast_comp->own(new CloseEnough(e, input)) });
+	cast_comp->m_sequences[2].addChildren({cast_comp->own(new CheckAbove(e, input)), cast_comp->own(new MoveToPlayer(e, input)) });
 }
 
 /// <summary>
@@ -52,9 +52,8 @@ void AISystem::createTree()
 /// </summary>
 void AISystem::runTree()
 {
-	for (auto c : m_components)
+	for (auto cast_comp : m_items)
 	{
-		auto cast_comp = dynamic_cast<AIComponent *>(c);
 		//Set input handler states back to default
 		cast_comp->m_input->m_current = cast_comp->m_input->m_default;
 
@@ -83,13 +82,5 @@ void AISystem::update(double dt)
 		timer = 0;
 	}
 
-	for (auto c : m_components)
-	{
-		auto comp = static_cast<AIComponent*>(c);
-		auto pos = static_cast<PositionComponent *>(&comp->m_self->getComponent("Pos"));
-		comp->m_left->m_body->setPosition(pos->position.x - 45, pos->position.y + 1);
-		comp->m_right->m_body->setPosition(pos->position.x + 45, pos->position.y + 1);
-	}
-
 	timer += dt;
 }
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include "SpriteComponent.h"
 #include "AnimationComponent.h"
 #include "RenderSystem.h"
+#include "AnimationSystem.h"
 
 AchievementsScene::AchievementsScene() :
 	m_bgE("BG"),
@@ -102,46 +103,46 @@ void AchievementsScene::start()
 			anim->playAnimation("Unlocked", false);
 
 			ent.addComponent("Animation", anim);
-			Scene::systems()["Animation"]->addComponent(anim);
+			Scene::systems().get<AnimationSystem>()->addComponent(anim);
 		}
 	}
 
 	for (auto& icon : m_icons)
-		Scene::systems()["Render"]->addComponent(&icon.getComponent("Sprite"));
+		Scene::systems().get<RenderSystem>()->addComponent(&icon.getComponent("Sprite"));
 
-	Scene::systems()["Render"]->addComponent(&m_selectE.getComponent("Sprite"));
-	Scene::systems()["Render"]->addComponent(&m_selectE.getComponent("Des Sprite"));
-	Scene::systems()["Render"]->addComponent(&m_selectE.getComponent("Description Sprite"));
+	Scene::systems().get<RenderSystem>()->addComponent(&m_selectE.getComponent("Sprite"));
+	Scene::systems().get<RenderSystem>()->addComponent(&m_selectE.getComponent("Des Sprite"));
+	Scene::systems().get<RenderSystem>()->addComponent(&m_selectE.getComponent("Description Sprite"));
 
-	Scene::systems()["Animation"]->addComponent(&m_selectE.getComponent("A Animation"));
-	Scene::systems()["Animation"]->addComponent(&m_selectE.getComponent("B Animation"));
-	Scene::systems()["Animation"]->addComponent(&m_selectE.getComponent("C Animation"));
+	Scene::systems().get<AnimationSystem>()->addComponent(&m_selectE.getComponent("A Animation"));
+	Scene::systems().get<AnimationSystem>()->addComponent(&m_selectE.getComponent("B Animation"));
+	Scene::systems().get<AnimationSystem>()->addComponent(&m_selectE.getComponent("C Animation"));
 
 	//Add the bg to the render system
-	Scene::systems()["Render"]->addComponent(&m_bgE.getComponent("Sprite"));
+	Scene::systems().get<RenderSystem>()->addComponent(&m_bgE.getComponent("Sprite"));
 }
 
 void AchievementsScene::stop()
 {
 	for (auto& icon : m_icons)
-		Scene::systems()["Render"]->deleteComponent(&icon.getComponent("Sprite"));
+		Scene::systems().get<RenderSystem>()->deleteComponent(&icon.getComponent("Sprite"));
 
-	Scene::systems()["Render"]->deleteComponent(&m_selectE.getComponent("Sprite"));
-	Scene::systems()["Render"]->deleteComponent(&m_selectE.getComponent("Des Sprite"));
-	Scene::systems()["Render"]->deleteComponent(&m_selectE.getComponent("Description Sprite"));
+	Scene::systems().get<RenderSystem>()->deleteComponent(&m_selectE.getComponent("Sprite"));
+	Scene::systems().get<RenderSystem>()->deleteComponent(&m_selectE.getComponent("Des Sprite"));
+	Scene::systems().get<RenderSystem>()->deleteComponent(&m_selectE.getComponent("Description Sprite"));
 
-	Scene::systems()["Animation"]->deleteComponent(&m_selectE.getComponent("A Animation"));
-	Scene::systems()["Animation"]->deleteComponent(&m_selectE.getComponent("B Animation"));
-	Scene::systems()["Animation"]->deleteComponent(&m_selectE.getComponent("C Animation"));
+	Scene::systems().get<AnimationSystem>()->deleteComponent(&m_selectE.getComponent("A Animation"));
+	Scene::systems().get<AnimationSystem>()->deleteComponent(&m_selectE.getComponent("B Animation"));
+	Scene::systems().get<AnimationSystem>()->deleteComponent(&m_selectE.getComponent("C Animation"));
 
 	//Remove components from the systems
-	Scene::systems()["Render"]->deleteComponent(&m_bgE.getComponent("Sprite"));
+	Scene::systems().get<RenderSystem>()->deleteComponent(&m_bgE.getComponent("Sprite"));
 }
 
 void AchievementsScene::update(double dt)
 {
 	//Update the animations
-	Scene::systems()["Animation"]->update(dt);
+	Scene::systems().get<AnimationSystem>()->update(dt);
 
 	m_animTimer -= dt;
 
@@ -167,7 +168,7 @@ void AchievementsScene::update(double dt)
 void AchievementsScene::handleInput(InputSystem & input)
 {
 	//Update the input system
-	Scene::systems()["Input"]->update(0);
+	Scene::systems().get<InputSystem>()->update(0);
 	m_moveChange.zeroVector(); //Reset the movement change
 
 	if (!m_initialSetup)
@@ -238,5 +239,5 @@ void AchievementsScene::handleInput(InputSystem & input)
 
 void AchievementsScene::draw(SDL_Renderer & renderer)
 {
-	static_cast<RenderSystem*>(Scene::systems()["Render"])->render(renderer, m_camera);
+	Scene::systems().get<RenderSystem>()->render(renderer, m_camera);
 }
@@ -1,41 +1,77 @@
 #include "AnimationComponent.h"
+#include "Entity.h"
 
 AnimationComponent::AnimationComponent(Component* sprite) :
-	m_current(nullptr),
-	m_spriteToAnimate(sprite)
+	m_spriteToAnimate(sprite),
+	m_ownerPtr(nullptr),
+	m_current(-1)
 {
 
 }
 
-void AnimationComponent::addAnimation(std::string name, SDL_Texture* texture, std::vector<SDL_Rect> frames, float duration)
+void AnimationComponent::addAnimation(std::string name, TextureRegion texture, std::vector<SDL_Rect> frames, float duration)
 {
-	//Add the animation to our map
-	m_animations[name] = Animation(texture, name, frames, frames.size(), duration);
+	//Replace the animation if there is already one with this name
+	for (auto& animation : m_animations)
+	{
+		if (animation.getName() == name)
+		{
+			animation = Animation(texture, name, frames, frames.size(), duration);
+			return;
+		}
+	}
+	m_animations.push_back(Animation(texture, name, frames, frames.size(), duration));
 }
 
 void AnimationComponent::playAnimation(std::string name, bool loop)
 {
+	int next = -1;
+	for (size_t i = 0; i < m_animations.size(); i++)
+	{
+		if (m_animations[i].getName() == name)
+		{
+			next = i;
+			break;
+		}
+	}
+	if (next < 0)
+		return;
+
 	//If there is an animation playing then stop it, and play the ne wone
-	if (nullptr != m_current)
+	if (m_current >= 0)
 	{
-		if(m_current->getName() != name)
-			m_current->resetAnimation();
+		if(m_animations[m_current].getName() != name)
+			m_animations[m_current].resetAnimation();
 	}
 
-	m_current = &m_animations[name];
-	m_current->setLoop(loop);
+	m_current = next;
+	auto current = &m_animations[m_current];
+	current->setLoop(loop);
+
+	//An animation made before its entity has no sprite yet, the sprite starts on the first frame anyway
+	auto sprite = getSprite();
+	if (nullptr == sprite)
+		return;
+
 	//Set texture of the sprite based on the animation that is being played
-	getSprite()->setTexture(m_current->getTexture());
+	sprite->setTexture(current->getTexture());
 	//Set the destination width and height
-	auto sDst = getSprite()->getDestRect();
-	auto aDst = m_current->getCurrentTextureRect();
+	auto sDst = sprite->getDestRect();
+	auto aDst = current->getCurrentTextureRect();
 	sDst.w = aDst.w;
 	sDst.h = aDst.h;
-	getSprite()->setDestRect(sDst);
-	getSprite()->setSourceRect(aDst);
+	sprite->setDestRect(sDst);
+	sprite->setSourceRect(aDst);
+}
+
+SpriteComponent * AnimationComponent::getSprite()
+{
+	if (nullptr != m_ownerPtr)
+		return m_ownerPtr->get<SpriteComponent>();
+	return static_cast<SpriteComponent*>(m_spriteToAnimate);
 }
 
-AnimationComponent::Animation::Animation(SDL_Texture* texture, std::string name, std::vector<SDL_Rect> frames, int maxFrames, float duration) :
+AnimationComponent::Animation::Animation(TextureRegion texture, std::string name, std::vector<SDL_Rect> frames, int maxFrames, float duration) :
 	m_texture(texture),
 	m_name(name),
 	m_loop(false),
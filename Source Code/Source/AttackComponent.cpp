@@ -1,4 +1,9 @@
 #include "AttackComponent.h"
+#include <cassert>
+
+const Vector2f AttackComponent::PUNCH_SIZE = Vector2f(30, 25);
+const Vector2f AttackComponent::KICK_SIZE = Vector2f(50, 25);
+const Vector2f AttackComponent::UPPERCUT_SIZE = Vector2f(25, 45);
 
 AttackComponent::AttackComponent() :
 	m_e(nullptr),
@@ -6,15 +11,24 @@ AttackComponent::AttackComponent() :
 	m_attackActive(false),
 	m_startDelay(false),
 	m_attacked(false),
+	m_destroyAttack(false),
 	m_ttl(0),
 	m_delay(0),
 	m_xImpulse(0),
 	m_yImpulse(0),
 	m_dmg(0),
+	m_currentAttack(nullptr),
 	m_currentAttackTag("")
 {
 }
 
+AttackComponent::~AttackComponent()
+{
+	//The bodies and their ColData belong to the world, they go with it or with releaseHitboxes
+	for (auto& hitbox : m_hitboxes)
+		delete hitbox.physics;
+}
+
 void AttackComponent::attack(Vector2f offset, Vector2f size, Entity & e, std::string tag, float ttl, std::string attackName, float delay = 0)
 {
 	m_currentAttackTag = attackName;
@@ -41,18 +55,19 @@ void AttackComponent::spawn(Box2DBridge& world)
 	m_startDelay = false;
 	m_attackActive = true;
 
-	//get the players position
-	auto playerPos = static_cast<PositionComponent*>(&m_e->getComponent("Pos"))->position;
-
-	//Create the new attack
-	m_currentAttack = new PhysicsComponent(new PositionComponent(0,0));
+	//An attack that is still out is replaced by the new one
+	if (nullptr != m_currentAttack)
+		m_currentAttack->m_body->getBody()->SetActive(false);
 
-	m_currentAttack->m_body = world.createBox(playerPos.x + m_offset.x, playerPos.y + m_offset.y,
-		m_size.x, m_size.y, false, false, b2BodyType::b2_dynamicBody);
-	world.addProperties(*m_currentAttack->m_body, 0, 0, 0, true, new PhysicsComponent::ColData(m_tag, m_e));
+	//get the players position
+	auto playerPos = m_e->get<PositionComponent>()->position;
 
-	//Make attack body not affected by gravity
- 	m_currentAttack->m_body->getBody()->SetGravityScale(0);
+	//Switch on the hitbox for this attack where the attack starts
+	m_currentAttack = hitbox();
+	auto body = m_currentAttack->m_body;
+	body->setPosition(playerPos.x + m_offset.x, playerPos.y + m_offset.y);
+	body->getBody()->SetLinearVelocity(b2Vec2(0, 0));
+	body->getBody()->SetActive(true);
 }
 
 void AttackComponent::deleteAttack(Box2DBridge & world)
@@ -64,18 +79,75 @@ void AttackComponent::deleteAttack(Box2DBridge & world)
 	m_dmg = 0;
 	m_xImpulse = 0;
 	m_yImpulse = 0;
-	
-	world.deleteBody(m_currentAttack->m_body);
 
-	//Delete the current attack
-	delete m_currentAttack;
-	//Set current attack to nullptr
+	//Take the hitbox out of the world until the next attack that uses it
+	m_currentAttack->m_body->getBody()->SetActive(false);
+	m_currentAttack = nullptr;
+}
+
+/// <summary>
+/// Destroys the hitbox bodies straight away rather than
+/// queueing them, the component is deleted before
+/// the queue is emptied
+/// </summary>
+/// <param name="world"></param>
+void AttackComponent::releaseHitboxes(Box2DBridge & world)
+{
+	for (auto& hitbox : m_hitboxes)
+	{
+		world.destroyBody(*hitbox.physics->m_body);
+	}
 	m_currentAttack = nullptr;
+	m_attackActive = false;
+}
+
+/// <summary>
+/// Makes the punch, kick and uppercut hitboxes
+/// out of the world, spawning an attack only
+/// moves its hitbox and switches it on
+/// </summary>
+/// <param name="world"></param>
+/// <param name="e">The player the hitboxes belong to</param>
+void AttackComponent::createHitboxes(Box2DBridge & world, Entity & e)
+{
+	for (auto& size : { PUNCH_SIZE, KICK_SIZE, UPPERCUT_SIZE })
+	{
+		Hitbox hitbox;
+		hitbox.size = size;
+		hitbox.tag = "Attack";
+		hitbox.physics = new PhysicsComponent(nullptr);
+		hitbox.physics->m_body = world.createBox(0, 0, size.x, size.y, false, false, b2BodyType::b2_dynamicBody);
+		hitbox.data = new PhysicsComponent::ColData(hitbox.tag, &e);
+		world.addProperties(*hitbox.physics->m_body, 0, 0, 0, true, hitbox.data);
+
+		//Make attack body not affected by gravity, and keep it out of the world until it is used
+		hitbox.physics->m_body->getBody()->SetGravityScale(0);
+		hitbox.physics->m_body->getBody()->SetActive(false);
+
+		m_hitboxes.push_back(hitbox);
+	}
+}
+
+/// <summary>
+/// Finds the hitbox for the size and tag
+/// of the current attack
+/// </summary>
+/// <returns></returns>
+PhysicsComponent* AttackComponent::hitbox()
+{
+	for (auto& hitbox : m_hitboxes)
+	{
+		if (hitbox.tag == m_tag && hitbox.size.x == m_size.x && hitbox.size.y == m_size.y)
+			return hitbox.physics;
+	}
+
+	assert(false && "No hitbox for this attack, was createHitboxes called?");
+	return nullptr;
 }
 
 void AttackComponent::updatePosition()
 {
-	auto playerPos = static_cast<PlayerPhysicsComponent*>(&m_e->getComponent("Player Physics"));
+	auto playerPos = m_e->get<PlayerPhysicsComponent>();
 	m_currentAttack->m_body->setPosition(playerPos->m_body->getPosition().x + m_offset.x, playerPos->m_body->getPosition().y + m_offset.y);
 }
 
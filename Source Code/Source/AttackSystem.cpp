@@ -2,7 +2,7 @@
 
 void AttackSystem::addComponent(Component * comp)
 {
-	m_components.push_back(comp);
+	insertComponent(comp);
 }
 
 void AttackSystem::update(double dt)
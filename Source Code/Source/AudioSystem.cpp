@@ -2,7 +2,7 @@
 
 void AudioSystem::addComponent(Component * comp)
 {
-	m_components.push_back(comp);
+	insertComponent(comp);
 }
 
 void AudioSystem::update(double dt)
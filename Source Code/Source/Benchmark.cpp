@@ -0,0 +1,272 @@
+#include "Benchmark.h"
+#include "json.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <regex>
+#include <thread>
+
+using json = nlohmann::json;
+
+const volatile char* volatile Benchmark::s_sink = nullptr;
+
+Benchmark::State::State(long long iterations, long long arg) :
+	m_iterations(iterations),
+	m_left(iterations),
+	m_arg(arg),
+	m_items(0),
+	m_started(false),
+	m_paused(false),
+	m_cpuStart(0),
+	m_realSeconds(0),
+	m_cpuSeconds(0)
+{
+}
+
+/// <summary>
+/// Starts the clocks the first time it is
+/// called and stops them once the
+/// iterations have run out
+/// </summary>
+bool Benchmark::State::running()
+{
+	if (m_started == false)
+	{
+		m_started = true;
+		m_cpuStart = std::clock();
+		m_start = Clock::now();
+	}
+
+	if (m_left > 0)
+	{
+		m_left--;
+		return true;
+	}
+
+	if (m_paused == false)
+		pauseTiming();
+	return false;
+}
+
+void Benchmark::State::pauseTiming()
+{
+	m_realSeconds += std::chrono::duration<double>(Clock::now() - m_start).count();
+	m_cpuSeconds += double(std::clock() - m_cpuStart) / CLOCKS_PER_SEC;
+	m_paused = true;
+}
+
+void Benchmark::State::resumeTiming()
+{
+	m_paused = false;
+	m_cpuStart = std::clock();
+	m_start = Clock::now();
+}
+
+std::vector<Benchmark::Entry>& Benchmark::entries()
+{
+	static std::vector<Entry> list;
+	return list;
+}
+
+void Benchmark::add(const std::string& name, Function function, std::vector<long long> args)
+{
+	if (args.empty())
+	{
+		entries().push_back({ name, function, 0 });
+		return;
+	}
+
+	for (auto arg : args)
+		entries().push_back({ name + "/" + std::to_string(arg), function, arg });
+}
+
+/// <summary>
+/// Runs the benchmark with more and more
+/// iterations until a run takes at least
+/// the minimum time, that run is the result
+/// </summary>
+Benchmark::Result Benchmark::run(const Entry& entry, double minTime)
+{
+	const long long MAX_ITERATIONS = 1000000000;
+	long long iterations = 1;
+
+	while (true)
+	{
+		State state(iterations, entry.arg);
+		entry.function(state);
+
+		if (state.m_realSeconds >= minTime || iterations >= MAX_ITERATIONS)
+		{
+			Result result;
+			result.name = entry.name;
+			result.runName = entry.name;
+			result.repetition = 0;
+			result.iterations = iterations;
+			result.realTime = state.m_realSeconds * 1e9 / iterations;
+			result.cpuTime = state.m_cpuSeconds * 1e9 / iterations;
+			result.itemsPerSecond = state.m_items > 0 && state.m_realSeconds > 0 ? state.m_items / state.m_realSeconds : 0;
+			result.label = state.m_label;
+			return result;
+		}
+
+		//Aim a bit past the minimum so the next run is very likely the last, but never grow more than 10x at once
+		auto multiplier = state.m_realSeconds > 0 ? minTime * 1.4 / state.m_realSeconds : 10.0;
+		multiplier = std::min(std::max(multiplier, 1.0), 10.0);
+		iterations = std::min(MAX_ITERATIONS, std::max(iterations + 1, (long long)(iterations * multiplier)));
+	}
+}
+
+int Benchmark::main(int argc, char* argv[])
+{
+	std::string filter = ".";
+	std::string format = "console";
+	std::string outPath;
+	double minTime = 0.5;
+	int repetitions = 1;
+
+	for (int i = 1; i < argc; i++)
+	{
+		std::string arg = argv[i];
+		auto value = arg.substr(arg.find('=') + 1);
+		if (arg.find("--benchmark_filter=") == 0)
+			filter = value;
+		else if (arg.find("--benchmark_min_time=") == 0)
+			minTime = atof(value.c_str());
+		else if (arg.find("--benchmark_repetitions=") == 0)
+			repetitions = std::max(1, atoi(value.c_str()));
+		else if (arg.find("--benchmark_format=") == 0)
+			format = value;
+		else if (arg.find("--benchmark_out=") == 0)
+			outPath = value;
+		else
+		{
+			std::cout << "Usage: " << argv[0] << " [--benchmark_filter=regex] [--benchmark_min_time=seconds] [--benchmark_repetitions=n]"
+				<< " [--benchmark_format=console|json] [--benchmark_out=path]" << std::endl;
+			return 1;
+		}
+	}
+
+	std::regex pattern(filter);
+	std::vector<Result> results;
+	auto console = format != "json";
+	if (console)
+		printf("%-40s %15s %15s %12s %16s\n", "Benchmark", "Time (ns)", "CPU (ns)", "Iterations", "Items/s");
+
+	for (auto& entry : entries())
+	{
+		if (std::regex_search(entry.name, pattern) == false)
+			continue;
+
+		std::vector<Result> runs;
+		for (int r = 0; r < repetitions; r++)
+		{
+			auto result = run(entry, minTime);
+			result.repetition = r;
+			if (repetitions > 1)
+			{
+				result.name += "/repeats:" + std::to_string(repetitions);
+				result.runName = result.name;
+			}
+			runs.push_back(result);
+
+			if (console)
+				printf("%-40s %15.1f %15.1f %12lld %16.0f %s\n", result.name.c_str(), result.realTime, result.cpuTime,
+					result.iterations, result.itemsPerSecond, result.label.c_str());
+		}
+		results.insert(results.end(), runs.begin(), runs.end());
+
+		//Mean and median over the repetitions, compare.py picks these up as aggregates
+		if (repetitions > 1)
+		{
+			for (auto aggregate : { "mean", "median" })
+			{
+				auto result = runs[0];
+				result.name = runs[0].name + "_" + aggregate;
+				result.repetition = -1;
+				result.label = aggregate;
+
+				std::vector<double> real, cpu, items;
+				for (auto& run : runs)
+				{
+					real.push_back(run.realTime);
+					cpu.push_back(run.cpuTime);
+					items.push_back(run.itemsPerSecond);
+				}
+				auto pick = [aggregate](std::vector<double>& values)
+				{
+					std::sort(values.begin(), values.end());
+					if (strcmp(aggregate, "median") == 0)
+						return values.size() % 2 ? values[values.size() / 2] : (values[values.size() / 2 - 1] + values[values.size() / 2]) / 2;
+					double total = 0;
+					for (auto v : values)
+						total += v;
+					return total / values.size();
+				};
+				result.realTime = pick(real);
+				result.cpuTime = pick(cpu);
+				result.itemsPerSecond = pick(items);
+				results.push_back(result);
+
+				if (console)
+					printf("%-40s %15.1f %15.1f %12s %16.0f\n", result.name.c_str(), result.realTime, result.cpuTime, "", result.itemsPerSecond);
+			}
+		}
+	}
+
+	char date[32];
+	auto now = std::time(nullptr);
+	std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+
+	json out;
+	out["context"] = {
+		{ "date", date },
+		{ "executable", argv[0] },
+		{ "num_cpus", std::thread::hardware_concurrency() },
+#ifdef NDEBUG
+		{ "library_build_type", "release" }
+#else
+		{ "library_build_type", "debug" }
+#endif
+	};
+	out["benchmarks"] = json::array();
+	for (auto& result : results)
+	{
+		json b = {
+			{ "name", result.name },
+			{ "run_name", result.runName },
+			{ "run_type", result.repetition < 0 ? "aggregate" : "iteration" },
+			{ "repetitions", repetitions },
+			{ "iterations", result.iterations },
+			{ "real_time", result.realTime },
+			{ "cpu_time", result.cpuTime },
+			{ "time_unit", "ns" }
+		};
+		if (result.repetition < 0)
+			b["aggregate_name"] = result.label;
+		else
+			b["repetition_index"] = result.repetition;
+		if (result.itemsPerSecond > 0)
+			b["items_per_second"] = result.itemsPerSecond;
+		if (result.repetition >= 0 && result.label.empty() == false)
+			b["label"] = result.label;
+		out["benchmarks"].push_back(b);
+	}
+
+	if (format == "json")
+		std::cout << out.dump(2) << std::endl;
+	if (outPath.empty() == false)
+	{
+		std::ofstream file(outPath);
+		if (file.is_open() == false)
+		{
+			std::cout << "Unable to write " << outPath << std::endl;
+			return 1;
+		}
+		file << out.dump(2) << std::endl;
+	}
+
+	return 0;
+}
@@ -0,0 +1,452 @@
+#include "Benchmark.h"
+#include "AnimationSystem.h"
+#include "AttackComponent.h"
+#include "BehaviourTree.h"
+#include "CollisionListener.h"
+#include "DustTriggerComponent.h"
+#include "Entity.h"
+#include "MatchInstance.h"
+#include "PhysicsTaskPool.h"
+#include "PhysicsComponent.h"
+#include "PlayerPhysicsComponent.h"
+#include "PositionComponent.h"
+#include "Random.h"
+#include "System.h"
+#include "Vector2f.h"
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <thread>
+#ifdef CYBERPUNCH_BENCH_RENDER
+#include "RenderSystem.h"
+#include "SpriteComponent.h"
+#endif
+
+#ifndef CYBERPUNCH_LEVEL_PATH
+#define CYBERPUNCH_LEVEL_PATH "./Resources/LevelData.txt"
+#endif
+
+//Micro benchmarks for the hot paths of the ECS, collisions and AI, plus whole matches stepped with no window.
+//Run with --benchmark_out=results.json and compare against a saved run to see whether a change made a difference
+
+//Stand ins for the component types a player has, so the entity looks like one without needing a world to build it
+template<int N>
+struct FillerComponent : public Component {};
+
+//Every component added to the entity the way the scenes add them, by name with the typed slot filled too
+static void fillEntity(Entity& e)
+{
+	e.addComponent("Pos", new PositionComponent(0, 0));
+	e.addComponent("Sprite", new FillerComponent<0>());
+	e.addComponent("Body", new FillerComponent<1>());
+	e.addComponent("Input", new FillerComponent<2>());
+	e.addComponent("Attack", new FillerComponent<3>());
+	e.addComponent("Animation", new FillerComponent<4>());
+	e.addComponent("Audio", new FillerComponent<5>());
+	e.addComponent("Player", new FillerComponent<6>());
+}
+
+static void entityGetComponent(Benchmark::State& state)
+{
+	Entity e("Player");
+	fillEntity(e);
+	while (state.running())
+	{
+		Benchmark::doNotOptimize(&e.getComponent("Player"));
+		Benchmark::doNotOptimize(&e.getComponent("Pos"));
+	}
+	state.setItemsProcessed(state.iterations() * 2);
+	e.deleteComponents();
+}
+
+static void entityGet(Benchmark::State& state)
+{
+	Entity e("Player");
+	fillEntity(e);
+	while (state.running())
+	{
+		Benchmark::doNotOptimize(e.get<FillerComponent<6>>());
+		Benchmark::doNotOptimize(e.get<PositionComponent>());
+	}
+	state.setItemsProcessed(state.iterations() * 2);
+	e.deleteComponents();
+}
+
+//Only holds the components, enough to time the base class add and delete
+class ListSystem : public System
+{
+public:
+	void addComponent(Component* c) override { insertComponent(c); }
+	void update(double dt) override {}
+};
+
+//Deletes every component in a random order, adding them back isn't timed
+static void systemDeleteComponent(Benchmark::State& state)
+{
+	std::vector<std::unique_ptr<Component>> owned;
+	std::vector<Component*> order;
+	ListSystem system;
+	for (long long i = 0; i < state.arg(); i++)
+	{
+		owned.emplace_back(new Component());
+		order.push_back(owned.back().get());
+		system.addComponent(owned.back().get());
+	}
+	Random random(state.arg());
+	for (int i = (int)order.size() - 1; i > 0; i--)
+		std::swap(order[i], order[random.range(i + 1)]);
+
+	while (state.running())
+	{
+		for (auto c : order)
+			system.deleteComponent(c);
+
+		state.pauseTiming();
+		for (auto& c : owned)
+			system.addComponent(c.get());
+		state.resumeTiming();
+	}
+	state.setItemsProcessed(state.iterations() * state.arg());
+}
+
+//Steps the packed animations of that many entities, each with a position, sprite and a looping animation like the dust
+static void animationSystemUpdate(Benchmark::State& state)
+{
+	EntityManager entities;
+	std::vector<SDL_Rect> frames;
+	for (int i = 0; i < 20; i++)
+		frames.push_back({ i * 90, 0, 90, 50 });
+
+	for (long long i = 0; i < state.arg(); i++)
+	{
+		auto handle = entities.create("Dust")->handle();
+		entities.add<PositionComponent>(handle, (float)i, 0.0f);
+		entities.add<SpriteComponent>(handle, nullptr, Vector2f(1800, 50), Vector2f(90, 50), TextureRegion(), 1);
+		auto& animation = entities.add<AnimationComponent>(handle, nullptr);
+		animation.addAnimation("Destroy", TextureRegion(), frames, .5f);
+		animation.playAnimation("Destroy", true);
+	}
+
+	AnimationSystem system;
+	system.setEntities(&entities);
+	while (state.running())
+		system.update(1.0 / 120.0);
+	state.setItemsProcessed(state.iterations() * state.arg());
+}
+
+#ifdef CYBERPUNCH_BENCH_RENDER
+//Adds sprites spread over the game's layers to an empty render system, a tenth of them static like the platforms
+static void renderSystemAddComponent(Benchmark::State& state)
+{
+	PositionComponent pos(0, 0);
+	std::vector<std::unique_ptr<SpriteComponent>> sprites;
+	Random random(state.arg());
+	for (long long i = 0; i < state.arg(); i++)
+	{
+		sprites.emplace_back(new SpriteComponent(&pos, Vector2f(64, 64), Vector2f(64, 64), TextureRegion(), random.range(10)));
+		if (i % 10 == 0)
+			sprites.back()->isStatic() = true;
+	}
+
+	RenderSystem system;
+	while (state.running())
+	{
+		for (auto& sprite : sprites)
+			system.addComponent(sprite.get());
+
+		state.pauseTiming();
+		system.removeAllComponents();
+		state.resumeTiming();
+	}
+	state.setItemsProcessed(state.iterations() * state.arg());
+}
+#endif
+
+//Vectors to work on, the same every run
+static std::vector<Vector2f> randomVectors(size_t count, uint64_t seed)
+{
+	Random random(seed);
+	std::vector<Vector2f> vectors;
+	for (size_t i = 0; i < count; i++)
+		vectors.push_back(Vector2f(float(random.real() * 2000 - 1000), float(random.real() * 2000 - 1000)));
+	return vectors;
+}
+
+static void vector2fAdd(Benchmark::State& state)
+{
+	auto a = randomVectors(1024, 1);
+	auto b = randomVectors(1024, 2);
+	std::vector<Vector2f> out(a.size());
+	while (state.running())
+	{
+		for (size_t i = 0; i < a.size(); i++)
+			out[i] = (a[i] + b[i]) * 0.5f;
+		Benchmark::doNotOptimize(out.data());
+	}
+	state.setItemsProcessed(state.iterations() * a.size());
+}
+
+static void vector2fNormalise(Benchmark::State& state)
+{
+	auto a = randomVectors(1024, 1);
+	std::vector<Vector2f> out(a.size());
+	while (state.running())
+	{
+		for (size_t i = 0; i < a.size(); i++)
+			out[i] = a[i].normalise();
+		Benchmark::doNotOptimize(out.data());
+	}
+	state.setItemsProcessed(state.iterations() * a.size());
+}
+
+static void vector2fDistance(Benchmark::State& state)
+{
+	auto a = randomVectors(1024, 1);
+	auto b = randomVectors(1024, 2);
+	while (state.running())
+	{
+		float total = 0;
+		for (size_t i = 0; i < a.size(); i++)
+			total += a[i].distance(b[i]);
+		Benchmark::doNotOptimize(total);
+	}
+	state.setItemsProcessed(state.iterations() * a.size());
+}
+
+//Two overlapping bodies so Box2D makes a real contact to hand to the listener
+struct ContactFixture
+{
+	ContactFixture(const std::string& tagA, const std::string& tagB, void* data) :
+		world(b2Vec2(0, 10)),
+		dataA(tagA, data),
+		dataB(tagB, data)
+	{
+		b2PolygonShape box;
+		box.SetAsBox(1, 1);
+
+		b2BodyDef def;
+		def.type = b2_dynamicBody;
+		auto a = world.CreateBody(&def);
+		b2FixtureDef fixture;
+		fixture.shape = &box;
+		fixture.userData = &dataA;
+		a->CreateFixture(&fixture);
+
+		def.type = b2_staticBody;
+		def.position.Set(0, 1.5f);
+		auto b = world.CreateBody(&def);
+		fixture.userData = &dataB;
+		b->CreateFixture(&fixture);
+
+		world.Step(1 / 120.0f, 1, 1);
+		contact = world.GetContactList();
+	}
+
+	b2World world;
+	PhysicsComponent::ColData dataA, dataB;
+	b2Contact* contact;
+};
+
+//A pair of tags none of the checks care about, the cost of getting through all of them
+static void collisionBeginContactMiss(Benchmark::State& state)
+{
+	ContactFixture fixture("Player Body", "Floor", nullptr);
+	CollisionListener listener;
+	while (state.running())
+		listener.BeginContact(fixture.contact);
+}
+
+//A jump sensor landing on the floor, the most common contact there is
+static void collisionBeginContactLanding(Benchmark::State& state)
+{
+	Entity player("Player");
+	PlayerPhysicsComponent physics(&player);
+	DustTriggerComponent dust;
+	player.addComponent("Player Physics", &physics);
+	player.addComponent("Dust Trigger", &dust);
+
+	ContactFixture fixture("Jump Sensor", "Floor", &player);
+	CollisionListener listener;
+	while (state.running())
+		listener.BeginContact(fixture.contact);
+}
+
+//A player throwing punches, kicks and uppercuts in turn, each one spawned, stepped once and taken away again
+static void attackSpawnDelete(Benchmark::State& state)
+{
+	Box2DBridge world;
+	world.initWorld();
+	Entity player("Player");
+	PositionComponent pos(100, 100);
+	AttackComponent attack;
+	player.addComponent("Pos", &pos);
+	player.addComponent("Attack", &attack);
+	attack.createHitboxes(world, player);
+
+	const Vector2f SIZES[] = { AttackComponent::PUNCH_SIZE, AttackComponent::KICK_SIZE, AttackComponent::UPPERCUT_SIZE };
+	int next = 0;
+	while (state.running())
+	{
+		attack.attack(Vector2f(40, -12.5f), SIZES[next++ % 3], player, "Attack", .175f, "Punch", 0);
+		attack.spawn(world);
+		world.update(1 / 120.0);
+		attack.deleteAttack(world);
+	}
+	world.deleteWorld();
+}
+
+//Leaf that succeeds or fails on a fixed pattern, so the run takes a different path through the tree each time
+class PatternLeaf : public BehaviourTree::Node
+{
+public:
+	PatternLeaf(unsigned int pattern) : m_pattern(pattern), m_tick(0) {}
+	bool run() override { return (m_pattern >> (m_tick++ & 31)) & 1; }
+private:
+	unsigned int m_pattern;
+	unsigned int m_tick;
+};
+
+//Same shape as the bots' tree in AISystem::addComponent with the checks and actions swapped for leaves
+static void behaviourTreeRun(Benchmark::State& state)
+{
+	std::vector<std::unique_ptr<PatternLeaf>> nodes; //The tree doesn't own its leaves
+	Random random(1);
+	auto leaf = [&]()
+	{
+		nodes.emplace_back(new PatternLeaf(random()));
+		return nodes.back().get();
+	};
+
+	BehaviourTree tree;
+	BehaviourTree::Selector selectors[4];
+	BehaviourTree::Sequence sequences[3];
+	BehaviourTree::Sequence punchSequence;
+	BehaviourTree::RandomSelector randomSelector;
+	BehaviourTree::Succeeder succeeder;
+
+	tree.setRootChild(&selectors[0]);
+	selectors[0].addChildren({ &sequences[0], &selectors[3] });
+	sequences[0].addChildren({ leaf(), leaf(), leaf(), &succeeder, &selectors[1], &punchSequence });
+	succeeder.setChild(leaf());
+	selectors[1].addChildren({ leaf(), &selectors[2] });
+	selectors[2].addChildren({ leaf(), leaf() });
+	punchSequence.addChildren({ leaf(), &randomSelector });
+	randomSelector.addChildren({ leaf(), leaf() });
+	randomSelector.setRandom(&random);
+	selectors[3].addChildren({ &sequences[1], &sequences[2] });
+	sequences[1].addChildren({ leaf(), leaf() });
+	sequences[2].addChildren({ leaf(), leaf() });
+
+	while (state.running())
+		Benchmark::doNotOptimize(tree.run());
+}
+
+//A floor covered in debris, a box for each arg, apart from each other so every box is an island of its own
+static void stepDebris(Benchmark::State& state, b2TaskPool* pool)
+{
+	b2World world(b2Vec2(0, 10));
+	world.SetTaskPool(pool);
+
+	b2BodyDef def;
+	def.position.Set(0, 20);
+	b2PolygonShape floor;
+	floor.SetAsBox(1000, 1);
+	world.CreateBody(&def)->CreateFixture(&floor, 0);
+
+	b2PolygonShape box;
+	box.SetAsBox(.2f, .2f);
+	def.type = b2_dynamicBody;
+	def.allowSleep = false; //Asleep they wouldn't be solved at all
+	for (int i = 0; i < state.arg(); i++)
+	{
+		def.position.Set(-990 + (i * 1.5f), 18.5f);
+		world.CreateBody(&def)->CreateFixture(&box, 1);
+	}
+
+	//Let them land
+	for (int i = 0; i < 120; i++)
+		world.Step(1 / 120.0f, 8, 3);
+
+	while (state.running())
+		world.Step(1 / 120.0f, 8, 3);
+	state.setLabel(std::to_string(state.arg()) + " bodies");
+}
+
+static void box2DStep(Benchmark::State& state)
+{
+	stepDebris(state, nullptr);
+}
+
+//The same with the islands split over a pool, a task per core (at least two so the pool is used)
+static void box2DStepParallel(Benchmark::State& state)
+{
+	WorkerPool workers(std::max(2u, std::thread::hardware_concurrency()) - 1);
+	PhysicsTaskPool pool(workers);
+	stepDebris(state, &pool);
+}
+
+static json loadLevel()
+{
+	std::ifstream ifs(CYBERPUNCH_LEVEL_PATH);
+	if (ifs.is_open() == false)
+	{
+		std::cout << "Unable to open level " << CYBERPUNCH_LEVEL_PATH << std::endl;
+		exit(1);
+	}
+	std::string content((std::istreambuf_iterator<char>(ifs)), (std::istreambuf_iterator<char>()));
+	return json::parse(content);
+}
+
+//Two whole bot matches back to back, each to its end or to the same five minute cap the headless runner stops at.
+//Timing whole matches means even a run of one iteration covers players being knocked out and removed and a
+//match being torn down and the next one made. The items are fixed steps, items per second is the step rate
+static void matchUpdate(Benchmark::State& state)
+{
+	const double STEP_TIME = 1.0 / 120.0;
+	const double MAX_SECONDS = 300;
+	static const json level = loadLevel();
+	uint64_t seed = 1;
+	long long steps = 0;
+	int knockOuts = 0;
+
+	int matches = 0;
+
+	while (state.running())
+	{
+		for (int i = 0; i < 2; i++)
+		{
+			MatchInstance match(level, (int)state.arg(), seed++);
+			while (match.isOver() == false && match.elapsed() < MAX_SECONDS)
+				match.update(STEP_TIME);
+			steps += match.steps();
+			knockOuts += (int)state.arg() - match.playersLeft();
+			matches++;
+		}
+	}
+	state.setItemsProcessed(steps);
+	state.setLabel(std::to_string(state.arg()) + " players, " + std::to_string(matches) + " matches, " + std::to_string(knockOuts) + " knocked out");
+}
+
+int main(int argc, char* argv[])
+{
+	Benchmark::add("Entity_getComponent", entityGetComponent);
+	Benchmark::add("Entity_get", entityGet);
+	Benchmark::add("System_deleteComponent", systemDeleteComponent, { 64, 1024, 16384 });
+	Benchmark::add("AnimationSystem_update", animationSystemUpdate, { 64, 1024, 16384 });
+#ifdef CYBERPUNCH_BENCH_RENDER
+	Benchmark::add("RenderSystem_addComponent", renderSystemAddComponent, { 64, 1024, 16384 });
+#endif
+	Benchmark::add("Vector2f_add", vector2fAdd);
+	Benchmark::add("Vector2f_normalise", vector2fNormalise);
+	Benchmark::add("Vector2f_distance", vector2fDistance);
+	Benchmark::add("CollisionListener_BeginContact_miss", collisionBeginContactMiss);
+	Benchmark::add("CollisionListener_BeginContact_landing", collisionBeginContactLanding);
+	Benchmark::add("Attack_spawnDelete", attackSpawnDelete);
+	Benchmark::add("BehaviourTree_run", behaviourTreeRun);
+	Benchmark::add("Box2D_step", box2DStep, { 64, 1024 });
+	Benchmark::add("Box2D_step_parallel", box2DStepParallel, { 64, 1024 });
+	Benchmark::add("Match_update", matchUpdate, { 4, 16, 64 });
+
+	return Benchmark::main(argc, argv);
+}
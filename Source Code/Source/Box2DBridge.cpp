@@ -1,4 +1,5 @@
 #include "Box2DBridge.h"
+#include "PhysicsComponent.h"
 
 Box2DBridge::Box2DBridge() :
 	m_gravFlipped(false)
@@ -10,6 +11,7 @@ void Box2DBridge::initWorld()
 	m_world = new b2World(GRAVITY); //Create the world
 	m_world->SetGravity(GRAVITY); //Set the gravity of the world
 	m_world->SetContinuousPhysics(true);
+	m_timeSinceLastFrame = 0;
 }
 
 void Box2DBridge::update(double dt)
@@ -19,17 +21,24 @@ void Box2DBridge::update(double dt)
 	{
 		for (auto& body : m_bodiesToDelete)
 		{
-			m_world->DestroyBody(body->getBody());
+			destroyBody(*body);
 		}
 		m_bodiesToDelete.clear();
 	}
+	//Always step the world by the same amount, slow motion just means fewer steps
 	m_timeSinceLastFrame += dt;
-	if (m_timeSinceLastFrame > m_secondsPerFrame)
+	int steps = 0;
+	while (m_timeSinceLastFrame >= m_secondsPerFrame && steps < MAX_STEPS)
 	{
 		//Simulate the physics bodies
-		m_world->Step(m_timeSinceLastFrame, VELOCITY_ITERS, POSITION_ITERS); 
-		m_timeSinceLastFrame = 0;
+		m_world->Step(m_secondsPerFrame, VELOCITY_ITERS, POSITION_ITERS);
+		m_timeSinceLastFrame -= m_secondsPerFrame;
+		steps++;
 	}
+
+	//Too far behind to catch up, let the time go
+	if (m_timeSinceLastFrame >= m_secondsPerFrame)
+		m_timeSinceLastFrame = 0;
 }
 
 void Box2DBridge::flipGravity()
@@ -53,9 +62,56 @@ void Box2DBridge::deleteBody(Box2DBody * body)
 	m_bodiesToDelete.push_back(body);
 }
 
+void Box2DBridge::setTaskPool(b2TaskPool * pool)
+{
+	m_world->SetTaskPool(pool);
+}
+
+/// <summary>
+/// Takes the body out of the world and deletes
+/// the ColData of its fixtures, the Box2DBody is
+/// kept with no body until the world is deleted
+/// </summary>
+/// <param name="body"></param>
+void Box2DBridge::destroyBody(Box2DBody & body)
+{
+	if (nullptr == body.getBody())
+		return;
+
+	//Destroying the body ends its contacts and the listener still reads the ColData then, delete it after
+	std::vector<void*> data;
+	for (auto fixture = body.getBody()->GetFixtureList(); fixture != nullptr; fixture = fixture->GetNext())
+		data.push_back(fixture->GetUserData());
+
+	m_world->DestroyBody(body.getBody());
+	body.setBody(nullptr);
+
+	for (auto d : data)
+		delete static_cast<PhysicsComponent::ColData*>(d);
+}
+
+void Box2DBridge::destroyFixtureData(b2Body * body)
+{
+	for (auto fixture = body->GetFixtureList(); fixture != nullptr; fixture = fixture->GetNext())
+		delete static_cast<PhysicsComponent::ColData*>(fixture->GetUserData());
+}
+
+/// <summary>
+/// Deletes the world along with every body
+/// made in it and their ColData, deleting the
+/// world doesn't call the contact listener
+/// </summary>
 void Box2DBridge::deleteWorld()
 {
+	for (auto body = m_world->GetBodyList(); body != nullptr; body = body->GetNext())
+		destroyFixtureData(body);
 	delete m_world;
+	m_world = nullptr;
+
+	for (auto body : m_bodies)
+		delete body;
+	m_bodies.clear();
+	m_bodiesToDelete.clear();
 }
 
 Box2DBody* Box2DBridge::createBox(int posX, int posY, int width, int height, bool canRotate, bool allowSleep, b2BodyType type)
@@ -76,6 +132,7 @@ Box2DBody* Box2DBridge::createBox(int posX, int posY, int width, int height, boo
 
 	//Create the body and set it for our box2D body wrapper
 	body->setBody(m_world->CreateBody(&bDef));
+	m_bodies.push_back(body);
 
 	body->getBody()->CreateFixture(&fDef);
 	return body; //Return the body
@@ -96,6 +153,7 @@ Box2DBody* Box2DBridge::createCircle(int posX, int posY, float radius, bool canR
 	bDef.position.Set(posX, posY);
 
 	body->setBody(m_world->CreateBody(&bDef));
+	m_bodies.push_back(body);
 	return body; //Return the body
 }
 
@@ -107,9 +165,27 @@ void Box2DBridge::addProperties(Box2DBody & body, float mass, float friction, fl
 	fDef->SetDensity(mass); //Set the density/mass of the body
 	fDef->SetFriction(friction); //Set friction of the body
 	fDef->SetUserData(data); //Set the user data
+	fDef->SetFilterData(CollisionListener::filter(data)); //Only collide with what the collision category needs
 	fDef->SetRestitution(rest); //Set the restitution of the body
 }
 
+b2Fixture* Box2DBridge::addSensor(Box2DBody & body, float offsetX, float offsetY, int width, int height, void* data)
+{
+	b2FixtureDef fDef;
+	b2PolygonShape box;
+
+	//Set the box around the offset from the centre of the body
+	box.SetAsBox((width / 2.0f) / CONVERSION, (height / 2.0f) / CONVERSION, b2Vec2(offsetX / CONVERSION, offsetY / CONVERSION), 0);
+
+	fDef.shape = &box;
+	fDef.isSensor = true;
+	fDef.density = 0; //No density so the body keeps its mass
+	fDef.userData = data;
+	fDef.filter = CollisionListener::filter(data);
+
+	return body.getBody()->CreateFixture(&fDef);
+}
+
 void Box2DBody::setPosition(float x, float y)
 {
 	//Set the position of the physics body
@@ -119,8 +195,6 @@ void Box2DBody::setPosition(float x, float y)
 //Box2DBody methods
 Vector2f Box2DBody::getPosition()
 {
-	//Get the shape of the body
-	auto size = getSize();
 	m_position.x = (m_body->GetPosition().x * CONVERSION);
 	m_position.y = (m_body->GetPosition().y * CONVERSION);
 
@@ -130,7 +204,12 @@ Vector2f Box2DBody::getPosition()
 
 Vector2f Box2DBody::getSize()
 {
-	auto shape = m_body->GetFixtureList()->GetAABB(0);
+	//Sensors added later go on the front of the list, the body's own box is the last fixture
+	auto fixture = m_body->GetFixtureList();
+	while (fixture->GetNext() != nullptr)
+		fixture = fixture->GetNext();
+
+	auto shape = fixture->GetAABB(0);
 	return Vector2f(shape.GetExtents().x * CONVERSION * 2, shape.GetExtents().y * CONVERSION * 2);
 }
 
@@ -184,13 +184,13 @@ void ClientSocket::connectToServer()
 }
 
 // Function to check for any incoming messages
-string ClientSocket::checkForIncomingMessages()
+string ClientSocket::checkForIncomingMessages(unsigned int waitMs)
 {
 	// Define a string with a blank message
 	string receivedMessage = "";
 
-	// Poll for messages for a specified time (default: 10ms, so 100 times per second)
-	int activeSockets = SDLNet_CheckSockets(socketSet, ClientSocket::SOCKET_SET_POLL_PERIOD);
+	// Poll for messages for a specified time (default: 1ms)
+	int activeSockets = SDLNet_CheckSockets(socketSet, waitMs);
 
 	// This produces a LOT of debug output, so only uncomment if the code's really misbehaving...
 	//if (debug) { cout << "There are " << activeSockets << " socket(s) with data on them at the moment." << endl; }
@@ -9,321 +9,349 @@
 #include "AnimationComponent.h"
 #include "AIComponent.h"
 
+typedef CollisionCategory Cat;
 
-void CollisionListener::BeginContact(b2Contact * contact)
+//The collision data and the entity it belongs to, every fixture the game makes has one
+static PhysicsComponent::ColData* data(b2Fixture* fixture)
 {
-	//Convert both contact points to a ColData struct, from here we can check what tthe bodies are tagged with
-	auto dataA = static_cast<PhysicsComponent::ColData *>(contact->GetFixtureA()->GetUserData());
-	auto dataB = static_cast<PhysicsComponent::ColData *>(contact->GetFixtureB()->GetUserData());
-
-	//If the players jump sensor has hit a platform, set the player to be able to jump
-	if ((dataA->Tag() == "Jump Sensor" && dataB->Tag() == "Platform")
-	|| (dataB->Tag() == "Jump Sensor" && dataA->Tag() == "Platform")
-	|| (dataA->Tag() == "Jump Sensor" && dataB->Tag() == "Floor")
-	|| (dataB->Tag() == "Jump Sensor" && dataA->Tag() == "Floor"))
-	{
-		//Convert the collision data to a player pointer and call the allow jump method
-		auto player = static_cast<Entity*>(dataA->Tag() == "Jump Sensor" ? dataA->Data() : dataB->Data());
-		auto playerPhys = static_cast<PlayerPhysicsComponent*>(&player->getComponent("Player Physics"));
-
-		//If the player has hit a platform, set his can fall boolean
-		if (dataA->Tag() == "Platform" || dataB->Tag() == "Platform")
-		{
-			b2Fixture* sensor = dataA->Tag() == "Jump Sensor" ? contact->GetFixtureA() : contact->GetFixtureB();
-			b2Fixture* platform = dataA->Tag() == "Platform" ? contact->GetFixtureA() : contact->GetFixtureB();
-
-			auto platHeight = platform->GetBody()->GetFixtureList()->GetAABB(0).GetExtents().y / 2.0f; //get height of the sensor
-			auto sensPos = sensor->GetBody()->GetPosition(); //Get position of the sensor
-			auto platPos = platform->GetBody()->GetPosition(); //Get position of the platform
-
-			if ((!m_gravFlipped && sensPos.y <= platPos.y + platHeight)
-			|| (m_gravFlipped && sensPos.y >= platPos.y - platHeight))
-			{
-				playerPhys->setCanFall(true);
-				playerPhys->setCanJump(true);
-				//Create a dust particle for landing on the ground
-				static_cast<DustTriggerComponent*>(&player->getComponent("Dust Trigger"))->setCreate();
-			}
-		}
-		else if ((dataA->Tag() == "Jump Sensor" && dataB->Tag() == "Floor")
-			|| (dataB->Tag() == "Jump Sensor" && dataA->Tag() == "Floor"))
-		{
-			playerPhys->setCanJump(true);
-			//Create a dust particle for landing on the ground
-			static_cast<DustTriggerComponent*>(&player->getComponent("Dust Trigger"))->setCreate();
-		}
-	}
+	return static_cast<PhysicsComponent::ColData*>(fixture->GetUserData());
+}
 
-	if ((dataA->Tag() == "Jump Sensor" && dataB->Tag() == "Player Body")
-		|| (dataB->Tag() == "Jump Sensor" && dataA->Tag() == "Player Body"))
-	{
-		auto player = static_cast<Entity*>(dataA->Tag() == "Jump Sensor" ? dataA->Data() : dataB->Data());
-		auto playerPhys = static_cast<PlayerPhysicsComponent*>(&player->getComponent("Player Physics"));
+static Entity* entity(b2Fixture* fixture)
+{
+	return static_cast<Entity*>(data(fixture)->Data());
+}
 
-		playerPhys->setCanJump(true);
-		playerPhys->setOnPlayer(true);
-	}
-	
-	/// <summary>
-	/// Collision for the Player and the pickup, after collision triggers responses 
-	/// </summary>
-	/// <param name="contact"></param>
-	if ((dataA->Tag() == "Player Body" && dataB->Tag() == "Pickup")
-		|| (dataB->Tag() == "Player Body" && dataA->Tag() == "Pickup"))
-	{
-		auto player = static_cast<Entity*>(dataA->Tag() == "Player Body" ? dataA->Data() : dataB->Data());
-		auto pickUp = static_cast<Entity*>(dataB->Tag() == "Pickup" ? dataB->Data() : dataA->Data());
-
-		static_cast<PickUpComponent*>(&pickUp->getComponent("PickUp"))->teleport(player);
-		static_cast<AudioComponent&>(pickUp->getComponent("Audio")).playSound("PickUp 1", false);
-		auto p = static_cast<PlayerComponent*>(&player->getComponent("Player"));
-		//If player hits pickup, set status as dj
-		p->setDJ(true);
-	}
-	/// <summary>
-	/// Collision for when the player hits the booth, after collision triggers responses
-	/// </summary>
-	/// <param name="contact"></param>
-	if ((dataA->Tag() == "Attack" && dataB->Tag() == "Booth")
-		|| (dataB->Tag() == "Attack" && dataA->Tag() == "Booth"))
+CollisionListener::Table::Table()
+{
+	for (auto& row : entries)
 	{
-		auto booth = static_cast<Entity*>(dataA->Tag() == "Booth" ? dataA->Data() : dataB->Data());
-		auto djB = static_cast<DJBoothComponent*>(&booth->getComponent("DJ Booth"));
-		djB->run();
-		static_cast<PickUpComponent&>(djB->m_pickUp->getComponent("PickUp")).m_end = true;
-		static_cast<AudioComponent&>(booth->getComponent("Audio")).playSound("Switch2", false);
+		for (auto& entry : row)
+			entry = { nullptr, false };
 	}
+}
 
-	if ((dataA->Tag() == "Kill Box" && dataB->Tag() == "Player Body")
-		|| (dataB->Tag() == "Kill Box" && dataA->Tag() == "Player Body"))
-	{
-		auto player = static_cast<Entity*>(dataA->Tag() == "Player Body" ? dataA->Data() : dataB->Data());
+/// <summary>
+/// Fills in the handlers for every pair
+/// of categories and the filter masks
+/// that go with them
+/// </summary>
+CollisionListener::Handlers::Handlers()
+{
+	//Anything untagged keeps Box2D's default of colliding with everything
+	for (auto& mask : masks)
+		mask = Cat::bit(Cat::OTHER);
+	masks[Cat::OTHER] = 0xFFFF;
+
+	add(begin, Cat::JUMP_SENSOR, Cat::PLATFORM, &CollisionListener::landOnPlatform);
+	add(begin, Cat::JUMP_SENSOR, Cat::FLOOR, &CollisionListener::landOnFloor);
+	add(begin, Cat::JUMP_SENSOR, Cat::PLAYER_BODY, &CollisionListener::landOnPlayer);
+	add(begin, Cat::PLAYER_BODY, Cat::PICKUP, &CollisionListener::collectPickUp);
+	add(begin, Cat::ATTACK, Cat::BOOTH, &CollisionListener::hitBooth);
+	add(begin, Cat::KILL_BOX, Cat::PLAYER_BODY, &CollisionListener::enterKillBox);
+	add(begin, Cat::ATTACK, Cat::PLAYER_BODY, &CollisionListener::hitPlayer);
+
+	add(end, Cat::JUMP_SENSOR, Cat::PLATFORM, &CollisionListener::leaveGround);
+	add(end, Cat::JUMP_SENSOR, Cat::FLOOR, &CollisionListener::leaveGround);
+	add(end, Cat::JUMP_SENSOR, Cat::PLAYER_BODY, &CollisionListener::leavePlayer);
+	add(end, Cat::RIGHT_EDGE_SENSOR, Cat::PLATFORM, &CollisionListener::leaveRightEdge);
+	add(end, Cat::RIGHT_EDGE_SENSOR, Cat::FLOOR, &CollisionListener::leaveRightEdge);
+	add(end, Cat::LEFT_EDGE_SENSOR, Cat::PLATFORM, &CollisionListener::leaveLeftEdge);
+	add(end, Cat::LEFT_EDGE_SENSOR, Cat::FLOOR, &CollisionListener::leaveLeftEdge);
+	add(end, Cat::PLAYER_BODY, Cat::PLATFORM, &CollisionListener::leavePlatform);
+
+	add(preSolve, Cat::PLAYER_BODY, Cat::PLATFORM, &CollisionListener::passThroughPlatform);
+
+	//Solid pairs that push each other apart
+	collide(Cat::PLAYER_BODY, Cat::PLAYER_BODY);
+	collide(Cat::PLAYER_BODY, Cat::FLOOR);
+	collide(Cat::PLAYER_BODY, Cat::SCENERY);
+}
 
-		static_cast<PlayerComponent*>(&player->getComponent("Player"))->respawn();
-	}
-	
-	//Check if a player has attacked another player
-	checkPlayerAttack(contact);
+void CollisionListener::Handlers::add(Table& table, CollisionCategory::Type a, CollisionCategory::Type b, Handler handler)
+{
+	table.entries[a][b] = { handler, false };
+	if (a != b)
+		table.entries[b][a] = { handler, true };
+	collide(a, b);
+}
+
+void CollisionListener::Handlers::collide(CollisionCategory::Type a, CollisionCategory::Type b)
+{
+	masks[a] |= Cat::bit(b);
+	masks[b] |= Cat::bit(a);
+}
+
+const CollisionListener::Handlers& CollisionListener::handlers()
+{
+	static const Handlers table;
+	return table;
+}
+
+b2Filter CollisionListener::filter(void* userData)
+{
+	b2Filter filter;
+	auto category = userData ? static_cast<PhysicsComponent::ColData*>(userData)->Category() : Cat::OTHER;
+	filter.categoryBits = Cat::bit(category);
+	filter.maskBits = handlers().masks[category];
+	return filter;
+}
+
+/// <summary>
+/// Looks up the handler for the pair of
+/// categories and calls it with the fixtures
+/// in the order it expects them
+/// </summary>
+void CollisionListener::dispatch(const Table& table, b2Contact* contact)
+{
+	auto fixtureA = contact->GetFixtureA();
+	auto fixtureB = contact->GetFixtureB();
+	auto dataA = data(fixtureA);
+	auto dataB = data(fixtureB);
+	auto& entry = table.entries[dataA ? dataA->Category() : Cat::OTHER][dataB ? dataB->Category() : Cat::OTHER];
+
+	if (nullptr == entry.handler)
+		return;
+	if (entry.swap)
+		(this->*entry.handler)(contact, fixtureB, fixtureA);
+	else
+		(this->*entry.handler)(contact, fixtureA, fixtureB);
+}
+
+void CollisionListener::BeginContact(b2Contact * contact)
+{
+	dispatch(handlers().begin, contact);
 }
 
 void CollisionListener::EndContact(b2Contact * contact)
 {
-	//Convert both contact points to a ColData struct, from here we can check what tthe bodies are tagged with
-	auto dataA = static_cast<PhysicsComponent::ColData *>(contact->GetFixtureA()->GetUserData());
-	auto dataB = static_cast<PhysicsComponent::ColData *>(contact->GetFixtureB()->GetUserData());
-
-	//If the players jump sensor has stopped hitting a platform, set the player to be able to jump
-	if ((dataA->Tag() == "Jump Sensor" && dataB->Tag() == "Platform")
-		|| (dataB->Tag() == "Jump Sensor" && dataA->Tag() == "Platform")
-		|| (dataA->Tag() == "Jump Sensor" && dataB->Tag() == "Floor")
-		|| (dataB->Tag() == "Jump Sensor" && dataA->Tag() == "Floor"))
-	{
-		////Convert the collision data to a player pointer and call the allow jump method
-		auto player = static_cast<Entity*>(dataA->Tag() == "Jump Sensor" ? dataA->Data() : dataB->Data());
-		auto phys = static_cast<PlayerPhysicsComponent*>(&player->getComponent("Player Physics"));
-		phys->setCanJump(false);
-		phys->setCanFall(false);
-	}
+	dispatch(handlers().end, contact);
+}
 
-	if ((dataA->Tag() == "Jump Sensor" && dataB->Tag() == "Player Body")
-		|| (dataB->Tag() == "Jump Sensor" && dataA->Tag() == "Player Body"))
-	{
-		auto player = static_cast<Entity*>(dataA->Tag() == "Jump Sensor" ? dataA->Data() : dataB->Data());
-		auto playerPhys = static_cast<PlayerPhysicsComponent*>(&player->getComponent("Player Physics"));
+void CollisionListener::PreSolve(b2Contact * contact, const b2Manifold * oldManifold)
+{
+	dispatch(handlers().preSolve, contact);
+}
 
-		playerPhys->setCanJump(false);
-		playerPhys->setOnPlayer(false);
-	}
+void CollisionListener::PostSolve(b2Contact * contact, const b2ContactImpulse * impulse)
+{
 
-	if ((dataA->Tag() == "Right Edge Sensor" && dataB->Tag() == "Platform")
-		|| (dataB->Tag() == "Right Edge Sensor" && dataA->Tag() == "Platform")
-		|| (dataA->Tag() == "Right Edge Sensor" && dataB->Tag() == "Floor")
-		|| (dataB->Tag() == "Right Edge Sensor" && dataA->Tag() == "Floor"))
-	{
-		auto ai = static_cast<Entity*>(dataA->Tag() == "Right Edge Sensor" ? dataA->Data() : dataB->Data());
-		auto comp = static_cast<AIComponent *>(&ai->getComponent("AI"));
-		auto phys = static_cast<PlayerPhysicsComponent *>(&ai->getComponent("Player Physics"));
-
-		//If the right edge sensor is not touching the platform, but the AI is on a platform
-		if (phys->canJump())
-		{
-			//Set bool true in AI component
-			comp->onEdgeRight = true;
-		}
-	}
+}
+
+/// <summary>
+/// The players jump sensor has hit a platform,
+/// they can jump and fall through it if they
+/// landed on top of it
+/// </summary>
+void CollisionListener::landOnPlatform(b2Contact * contact, b2Fixture * sensor, b2Fixture * platform)
+{
+	auto player = entity(sensor);
+	auto playerPhys = player->get<PlayerPhysicsComponent>();
 
-	if ((dataA->Tag() == "Left Edge Sensor" && dataB->Tag() == "Platform")
-		|| (dataB->Tag() == "Left Edge Sensor" && dataA->Tag() == "Platform")
-		|| (dataA->Tag() == "Left Edge Sensor" && dataB->Tag() == "Floor")
-		|| (dataB->Tag() == "Left Edge Sensor" && dataA->Tag() == "Floor"))
+	auto platHeight = platform->GetAABB(0).GetExtents().y / 2.0f; //get height of the sensor
+	auto sensPos = sensor->GetBody()->GetWorldPoint(static_cast<b2PolygonShape*>(sensor->GetShape())->m_centroid); //Get position of the sensor, it is off the centre of the players body
+	auto platPos = platform->GetBody()->GetPosition(); //Get position of the platform
+
+	if ((!m_gravFlipped && sensPos.y <= platPos.y + platHeight)
+	|| (m_gravFlipped && sensPos.y >= platPos.y - platHeight))
 	{
-		auto ai = static_cast<Entity*>(dataA->Tag() == "Left Edge Sensor" ? dataA->Data() : dataB->Data());
-		auto comp = static_cast<AIComponent *>(&ai->getComponent("AI"));
-		auto phys = static_cast<PlayerPhysicsComponent *>(&ai->getComponent("Player Physics"));
-
-		//If the left edge sensor is not touching the platform, but the AI is on a platform
-		if (phys->canJump())
-		{
-			//Set bool true in AI component
-			comp->onEdgeLeft = true;
-		}
+		playerPhys->setCanFall(true);
+		playerPhys->setCanJump(true);
+		//Create a dust particle for landing on the ground
+		player->get<DustTriggerComponent>()->setCreate();
 	}
+}
 
-	//if a players body has hit a platform
-	if ((dataA->Tag() == "Player Body" && dataB->Tag() == "Platform")
-		|| (dataB->Tag() == "Player Body" && dataA->Tag() == "Platform"))
-	{
-		//Convert the collision data to a player pointer and call the allow jump method
-		auto player = dataA->Tag() == "Player Body" ? contact->GetFixtureA() : contact->GetFixtureB();
-		auto platform = dataA->Tag() == "Platform" ? contact->GetFixtureA() : contact->GetFixtureB();
+void CollisionListener::landOnFloor(b2Contact * contact, b2Fixture * sensor, b2Fixture * floor)
+{
+	auto player = entity(sensor);
+	player->get<PlayerPhysicsComponent>()->setCanJump(true);
+	//Create a dust particle for landing on the ground
+	player->get<DustTriggerComponent>()->setCreate();
+}
 
-		auto pPtr = static_cast<Entity*>(dataA->Tag() == "Player Body" ? dataA->Data() : dataB->Data());
+void CollisionListener::landOnPlayer(b2Contact * contact, b2Fixture * sensor, b2Fixture * body)
+{
+	auto playerPhys = entity(sensor)->get<PlayerPhysicsComponent>();
 
-		auto pHeight = player->GetBody()->GetFixtureList()->GetAABB(0).GetExtents().y; //get height of the player
+	playerPhys->setCanJump(true);
+	playerPhys->setOnPlayer(true);
+}
 
-		//Convert the collision data to a player pointer and call the allow jump method
-		auto phys = static_cast<PlayerPhysicsComponent*>(&pPtr->getComponent("Player Physics"));
+/// <summary>
+/// Collision for the Player and the pickup, after collision triggers responses
+/// </summary>
+void CollisionListener::collectPickUp(b2Contact * contact, b2Fixture * body, b2Fixture * pickUp)
+{
+	auto player = entity(body);
+	auto pickUpEntity = entity(pickUp);
 
-		//If the player is jumping up from below a platform, set it sensor to true
-		if ((!m_gravFlipped && player->GetBody()->GetPosition().y + pHeight < platform->GetBody()->GetPosition().y)
-			|| (m_gravFlipped && player->GetBody()->GetPosition().y - pHeight > platform->GetBody()->GetPosition().y))
-		{
-			//Set contact as disabled so the player can move through floors
-			phys->falling() = false;
-		}
-	}
+	pickUpEntity->get<PickUpComponent>()->teleport(player);
+	pickUpEntity->get<AudioComponent>()->playSound("PickUp 1", false);
+	//If player hits pickup, set status as dj
+	player->get<PlayerComponent>()->setDJ(true);
 }
 
-void CollisionListener::checkPlayerAttack(b2Contact * contact)
+/// <summary>
+/// Collision for when the player hits the booth, after collision triggers responses
+/// </summary>
+void CollisionListener::hitBooth(b2Contact * contact, b2Fixture * attack, b2Fixture * booth)
 {
-	//Cant handle attacks with other players yet, must get the player entities and convert them to Attacking/physics components etc..
-	auto dataA = static_cast<PhysicsComponent::ColData *>(contact->GetFixtureA()->GetUserData());
-	auto dataB = static_cast<PhysicsComponent::ColData *>(contact->GetFixtureB()->GetUserData());
-	Entity* attackingP = nullptr;
-	Entity* otherP = nullptr;
-	PlayerPhysicsComponent* otherPPhys = nullptr;
-	PlayerPhysicsComponent* attackingPPhys = nullptr;
-	AttackComponent* attackHit = nullptr;
-	float xImpulse;
-	float yImpulse;
-	int dmgP;
-	bool applyDmg = false;
-
-	//If a player has attacked and hit a player
-	if ((dataA->Tag() == "Attack" && dataB->Tag() == "Player Body")
-	|| (dataB->Tag() == "Attack" && dataA->Tag() == "Player Body"))
-	{
-		//get our player pointers
-		attackingP = static_cast<Entity*>(dataA->Tag() == "Attack" ? dataA->Data() : dataB->Data());
-		otherP = static_cast<Entity*>(dataA->Tag() == "Player Body" ? dataA->Data() : dataB->Data());
-		otherPPhys = static_cast<PlayerPhysicsComponent*>(&otherP->getComponent("Player Physics"));
-
-		if (attackingP == otherP)
-			return;
-
-		attackingPPhys = static_cast<PlayerPhysicsComponent*>(&attackingP->getComponent("Player Physics"));
-		attackHit = static_cast<AttackComponent*>(&attackingP->getComponent("Attack"));
-
-		//If the attacking player punched
-		if (attackHit->attacked() && !attackingPPhys->stunned())
-		{
-			applyDmg = true;
-			dmgP = attackHit->damage(); //Get the damage
-			xImpulse = attackHit->xImpulse();
-			yImpulse = attackHit->yImpulse();
-		}
-	}
+	auto boothEntity = entity(booth);
+	auto djB = boothEntity->get<DJBoothComponent>();
+	djB->run();
+	djB->m_pickUp->get<PickUpComponent>()->m_end = true;
+	boothEntity->get<AudioComponent>()->playSound("Switch2", false);
+}
 
-	//If the player was not found return
-	if (nullptr == attackingP || nullptr == otherP)
+void CollisionListener::enterKillBox(b2Contact * contact, b2Fixture * killBox, b2Fixture * body)
+{
+	entity(body)->get<PlayerComponent>()->respawn();
+}
+
+/// <summary>
+/// A player has attacked and hit a player
+/// </summary>
+void CollisionListener::hitPlayer(b2Contact * contact, b2Fixture * attack, b2Fixture * body)
+{
+	//get our player pointers
+	auto attackingP = entity(attack);
+	auto otherP = entity(body);
+
+	if (attackingP == otherP)
+		return;
+
+	auto otherPPhys = otherP->get<PlayerPhysicsComponent>();
+	auto attackingPPhys = attackingP->get<PlayerPhysicsComponent>();
+	auto attackHit = attackingP->get<AttackComponent>();
+
+	//Only if the attacking player punched
+	if (!attackHit->attacked() || attackingPPhys->stunned())
 		return;
-	else if(applyDmg)
+
+	auto dmgP = attackHit->damage(); //Get the damage
+	auto xImpulse = attackHit->xImpulse();
+	auto yImpulse = attackHit->yImpulse();
+
+	auto attackPlayerVariables = attackingP->get<PlayerComponent>();
+	auto otherPlayerVariables = otherP->get<PlayerComponent>();
+
+	otherPlayerVariables->m_hitBy = attackingP->handle();
+	otherPlayerVariables->m_hitWith = attackHit->m_currentAttackTag;
+
+	if (otherPlayerVariables->m_hitWith == "Punch" && attackingP->m_ID != "AI")
+		notify(nullptr, PUNCH_FIRST);
+
+	//If you attack a player that isnt super stunned, add to the super percentage
+	if(otherPPhys->superStunned() == false)
+		attackingPPhys->addSuper(dmgP); //Add damage to our super percentage
+	if (attackingPPhys->isSupered() && otherPPhys->superStunned() == false)
 	{
-		auto attackPlayerVariables = static_cast<PlayerComponent*>(&attackingP->getComponent("Player"));
-		auto otherPlayerVariables = static_cast<PlayerComponent*>(&otherP->getComponent("Player"));
-
-		otherPlayerVariables->m_hitBy = static_cast<Entity*>(dataA->Tag() == "Attack" ? dataA->Data() : dataB->Data());
-		otherPlayerVariables->m_hitWith = attackHit->m_currentAttackTag;
-
-		if (otherPlayerVariables->m_hitWith == "Punch" && attackingP->m_ID != "AI")
-			notify(nullptr, PUNCH_FIRST);
-
-		//If you attack a player that isnt super stunned, add to the super percentage
-		if(otherPPhys->superStunned() == false)
-			attackingPPhys->addSuper(dmgP); //Add damage to our super percentage
-		if (attackingPPhys->isSupered() && otherPPhys->superStunned() == false)
-		{
-			attackPlayerVariables->m_supersUsed++;
-			otherPlayerVariables->m_timesSuperStunned++;
-
-			otherPPhys->superStun(); //Super stun the other player
-			attackingPPhys->endSuper(); //End super for the player that hit with it
-			notify(otherP, Event::SUPER_STUN); //Send super stun event to the observer
-			static_cast<AnimationComponent&>(otherP->getComponent("Animation")).playAnimation("Super Stun", false);
-		}
-
-		otherPPhys->damage(dmgP); //Add damage of the punch to the other players damage percentage
-		otherPPhys->applyDamageImpulse(xImpulse, yImpulse); //Knock back the other player back
-		otherPPhys->stun();
-
-		//Add to the player componenet variables
-		attackPlayerVariables->m_dmgDealt += dmgP;
-		otherPlayerVariables->m_dmgTaken += dmgP;
-
-		//Notify our subject of the events that have happened
-		notify(attackingP, Event::DAMAGE_DEALT);
-		notify(otherP, Event::DAMAGE_TAKEN);
-
-		if(xImpulse < 75 && yImpulse < 75)
-			static_cast<AnimationComponent&>(otherP->getComponent("Animation")).playAnimation("Small Stun", false);
-		else
-			static_cast<AnimationComponent&>(otherP->getComponent("Animation")).playAnimation("Big Stun", false);
-
-		attackHit->destroyAttack() = true;
-		static_cast<AudioComponent&>(otherP->getComponent("Audio")).playSound("Punch", false);
+		attackPlayerVariables->m_supersUsed++;
+		otherPlayerVariables->m_timesSuperStunned++;
+
+		otherPPhys->superStun(); //Super stun the other player
+		attackingPPhys->endSuper(); //End super for the player that hit with it
+		notify(otherP, Event::SUPER_STUN); //Send super stun event to the observer
+		otherP->get<AnimationComponent>()->playAnimation("Super Stun", false);
 	}
 
+	otherPPhys->damage(dmgP); //Add damage of the punch to the other players damage percentage
+	otherPPhys->applyDamageImpulse(xImpulse, yImpulse); //Knock back the other player back
+	otherPPhys->stun();
+
+	//Add to the player componenet variables
+	attackPlayerVariables->m_dmgDealt += dmgP;
+	otherPlayerVariables->m_dmgTaken += dmgP;
+
+	//Notify our subject of the events that have happened
+	notify(attackingP, Event::DAMAGE_DEALT);
+	notify(otherP, Event::DAMAGE_TAKEN);
+
+	if(xImpulse < 75 && yImpulse < 75)
+		otherP->get<AnimationComponent>()->playAnimation("Small Stun", false);
+	else
+		otherP->get<AnimationComponent>()->playAnimation("Big Stun", false);
+
+	attackHit->destroyAttack() = true;
+	otherP->get<AudioComponent>()->playSound("Punch", false);
 }
 
-void CollisionListener::PreSolve(b2Contact * contact, const b2Manifold * oldManifold)
+/// <summary>
+/// The players jump sensor has stopped hitting
+/// a platform or the floor, they cant jump
+/// </summary>
+void CollisionListener::leaveGround(b2Contact * contact, b2Fixture * sensor, b2Fixture * ground)
 {
-	//Convert both contact points to a ColData struct, from here we can check what tthe bodies are tagged with
-	auto dataA = static_cast<PhysicsComponent::ColData *>(contact->GetFixtureA()->GetUserData());
-	auto dataB = static_cast<PhysicsComponent::ColData *>(contact->GetFixtureB()->GetUserData());
-	
-	//if a players body has hit a platform
-	if ((dataA->Tag() == "Player Body" && dataB->Tag() == "Platform")
-		|| (dataB->Tag() == "Player Body" && dataA->Tag() == "Platform"))
-	{
-		//Convert the collision data to a player pointer and call the allow jump method
-		auto player = dataA->Tag() == "Player Body" ? contact->GetFixtureA() : contact->GetFixtureB();
-		auto platform = dataA->Tag() == "Platform" ? contact->GetFixtureA() : contact->GetFixtureB();
+	auto phys = entity(sensor)->get<PlayerPhysicsComponent>();
+	phys->setCanJump(false);
+	phys->setCanFall(false);
+}
 
-		auto pPtr = static_cast<Entity*>(dataA->Tag() == "Player Body" ? dataA->Data() : dataB->Data());
+void CollisionListener::leavePlayer(b2Contact * contact, b2Fixture * sensor, b2Fixture * body)
+{
+	auto playerPhys = entity(sensor)->get<PlayerPhysicsComponent>();
 
-		auto pHeight = player->GetBody()->GetFixtureList()->GetAABB(0).GetExtents().y; //get height of the player
+	playerPhys->setCanJump(false);
+	playerPhys->setOnPlayer(false);
+}
 
-		//Convert the collision data to a player physics pointer and call the allow jump method
-		auto phys = static_cast<PlayerPhysicsComponent*>(&pPtr->getComponent("Player Physics"));
+void CollisionListener::leaveRightEdge(b2Contact * contact, b2Fixture * sensor, b2Fixture * ground)
+{
+	auto ai = entity(sensor);
 
-		//If the player is jumping up from below a platform, set it sensor to true
-		if ((!m_gravFlipped && player->GetBody()->GetPosition().y + (pHeight / 2) >= platform->GetBody()->GetPosition().y)
-			|| (m_gravFlipped && player->GetBody()->GetPosition().y - (pHeight / 2) <= platform->GetBody()->GetPosition().y)
-			|| (phys->falling()))
-		{
-			//Set contact as disabled so the player can move through floors
-			contact->SetEnabled(false);
-		}
+	//If the right edge sensor is not touching the platform, but the AI is on a platform
+	if (ai->get<PlayerPhysicsComponent>()->canJump())
+		ai->get<AIComponent>()->onEdgeRight = true;
+}
+
+void CollisionListener::leaveLeftEdge(b2Contact * contact, b2Fixture * sensor, b2Fixture * ground)
+{
+	auto ai = entity(sensor);
+
+	//If the left edge sensor is not touching the platform, but the AI is on a platform
+	if (ai->get<PlayerPhysicsComponent>()->canJump())
+		ai->get<AIComponent>()->onEdgeLeft = true;
+}
+
+/// <summary>
+/// A players body has stopped touching a platform,
+/// if it went up through it the player isnt
+/// falling through platforms any more
+/// </summary>
+void CollisionListener::leavePlatform(b2Contact * contact, b2Fixture * player, b2Fixture * platform)
+{
+	auto pHeight = player->GetAABB(0).GetExtents().y; //get height of the player
+	auto phys = entity(player)->get<PlayerPhysicsComponent>();
+
+	if ((!m_gravFlipped && player->GetBody()->GetPosition().y + pHeight < platform->GetBody()->GetPosition().y)
+		|| (m_gravFlipped && player->GetBody()->GetPosition().y - pHeight > platform->GetBody()->GetPosition().y))
+	{
+		phys->falling() = false;
 	}
 }
 
-void CollisionListener::PostSolve(b2Contact * contact, const b2ContactImpulse * impulse)
+/// <summary>
+/// A players body is touching a platform, it passes
+/// through if the player is coming up from below
+/// or dropping down through it
+/// </summary>
+void CollisionListener::passThroughPlatform(b2Contact * contact, b2Fixture * player, b2Fixture * platform)
 {
+	auto pHeight = player->GetAABB(0).GetExtents().y; //get height of the player
+	auto phys = entity(player)->get<PlayerPhysicsComponent>();
 
+	//If the player is jumping up from below a platform, set it sensor to true
+	if ((!m_gravFlipped && player->GetBody()->GetPosition().y + (pHeight / 2) >= platform->GetBody()->GetPosition().y)
+		|| (m_gravFlipped && player->GetBody()->GetPosition().y - (pHeight / 2) <= platform->GetBody()->GetPosition().y)
+		|| (phys->falling()))
+	{
+		//Set contact as disabled so the player can move through floors
+		contact->SetEnabled(false);
+	}
 }
 
 void CollisionListener::flipGravity()
 {
 	m_gravFlipped = !m_gravFlipped;
 }
-
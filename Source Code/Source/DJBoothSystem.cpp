@@ -7,16 +7,30 @@
 
 void DJBoothSystem::addComponent(Component * comp)
 {
-	m_components.push_back(comp);
+	insertComponent(comp);
+
+	//Keep hold of the slow booth, the game asks it for the time scale every frame
+	auto slow = dynamic_cast<SlowBoothComponent*>(comp);
+	if (nullptr != slow)
+		m_slowBooth = slow;
+}
+
+void DJBoothSystem::removeAllComponents()
+{
+	TypedSystem::removeAllComponents();
+	m_slowBooth = nullptr;
+
+	//The next match starts on the first background, colour and track again
+	m_currentBg = 0;
+	m_currentPc = 0;
+	m_currentTrack = 0;
 }
 
 void DJBoothSystem::update(double dt)
 {
 	
-	for (auto& comp : m_components)
+	for (auto booth : m_items)
 	{
-		auto booth = static_cast<DJBoothComponent*>(comp);
-
 		booth->update(dt);
 
 		//increments the backgorund, platform colour and the in game song
@@ -35,17 +49,19 @@ void DJBoothSystem::update(double dt)
 			if (m_currentTrack > 3)
 				m_currentTrack = 0;
 
-			//sets the background, music and platform colour
+#ifndef CYBERPUNCH_HEADLESS
+			//sets the background, music and platform colour, there's nothing to show when running headless
 			m_audioPtr->playSound("GameMusic" + std::to_string(m_currentTrack), true);
-			auto bgSprite = static_cast<SpriteComponent*>(&m_bgPtr->getComponent("Sprite"));
+			auto bgSprite = m_bgPtr->get<SpriteComponent>();
 			bgSprite->setTexture(m_resourcePtr->getTexture("Game BG" + std::to_string(m_currentBg)));
 
 			//Loop through all platforms and floors and switch the colours
 			for (auto& plat : *m_platformsPtr)
 			{
-				auto s = static_cast<SpriteComponent*>(&plat->getComponent("Sprite"));
-				s->setTexture(static_cast<PlatformComponent*>(&plat->getComponent("Platform"))->getTexture("Game BG" + std::to_string(m_currentBg)));
+				auto s = plat->get<SpriteComponent>();
+				s->setTexture(plat->get<PlatformComponent>()->getTexture("Game BG" + std::to_string(m_currentBg)));
 			}
+#endif
 
 			booth->bgSwitch = false;
 
@@ -57,15 +73,9 @@ void DJBoothSystem::update(double dt)
 
 float DJBoothSystem::getScalar()
 {
-	for (auto& comp : m_components)
+	if (nullptr != m_slowBooth)
 	{
-		auto c = dynamic_cast<SlowBoothComponent*>(comp);
-
-		if (nullptr != c)
-		{
-			return c->getScaler();
-		}
-
+		return m_slowBooth->getScaler();
 	}
 
 	return 1.0f;
@@ -1,12 +1,11 @@
 #include "DustSystem.h"
 #include "PlayerPhysicsComponent.h"
-#include "RenderSystem.h"
 #include "AnimationComponent.h"
 
-DustSystem::DustSystem(std::map<std::string, System*>* systems, std::vector<Entity*>* players, ResourceHandler* rH) :
-	m_systems(systems),
+DustSystem::DustSystem(std::vector<Entity*>* players, ResourceHandler* rH, EntityCommandBuffer* commands) :
 	m_players(players),
-	m_resourcesPtr(rH)
+	m_resourcesPtr(rH),
+	m_commandsPtr(commands)
 {
 	for (int i = 0; i < 20; i++)
 	{
@@ -16,7 +15,7 @@ DustSystem::DustSystem(std::map<std::string, System*>* systems, std::vector<Enti
 
 void DustSystem::addComponent(Component * c)
 {
-	m_components.push_back(c);
+	insertComponent(c);
 }
 
 void DustSystem::update(double dt)
@@ -24,32 +23,32 @@ void DustSystem::update(double dt)
 	//Loops through all the players
 	for (auto& player : *m_players)
 	{
-		if (static_cast<DustTriggerComponent*>(&player->getComponent("Dust Trigger"))->toCreate())
+		if (player->get<DustTriggerComponent>()->toCreate())
 		{
-			auto pPhys = static_cast<PlayerPhysicsComponent*>(&player->getComponent("Player Physics"));
-			static_cast<DustTriggerComponent*>(&player->getComponent("Dust Trigger"))->toCreate() = false; //Reset the trigger
+			auto pPhys = player->get<PlayerPhysicsComponent>();
+			player->get<DustTriggerComponent>()->toCreate() = false; //Reset the trigger
 
-			auto d = new Entity("Dust");
-			auto pos = new PositionComponent(pPhys->m_body->getPosition().x, pPhys->m_body->getPosition().y + 25);
-			d->addComponent("Pos", pos);
-			d->addComponent("Dust", new DustComponent());
-			d->addComponent("Sprite", new SpriteComponent(pos, Vector2f(1800, 50), Vector2f(90, 50), m_resourcesPtr->getTexture("Player Dust"), 1));
-			auto anim = new AnimationComponent(&d->getComponent("Sprite"));
-			anim->addAnimation("Destroy", m_resourcesPtr->getTexture("Player Dust"), m_dustFrames, .5f);
-			anim->playAnimation("Destroy", false);
-			d->addComponent("Animation", anim);
-			(*m_systems)["Animation"]->addComponent(anim);
-			(*m_systems)["Render"]->addComponent(&d->getComponent("Sprite"));
+			//The entity is made at the end of the frame, the components go on it then.
+			//The sprite already shows the first frame so the animation doesn't need it until it is running
+			auto d = m_commandsPtr->create("Dust");
+			auto dust = new DustComponent();
+			AnimationComponent anim(nullptr);
+			anim.addAnimation("Destroy", m_resourcesPtr->getTexture("Player Dust"), m_dustFrames, .5f);
+			anim.playAnimation("Destroy", false);
+			m_commandsPtr->add(d, PositionComponent(pPhys->m_body->getPosition().x, pPhys->m_body->getPosition().y + 25));
+			m_commandsPtr->attach(d, "Dust", dust);
+			m_commandsPtr->add(d, SpriteComponent(nullptr, Vector2f(1800, 50), Vector2f(90, 50), m_resourcesPtr->getTexture("Player Dust"), 1));
+			m_commandsPtr->add(d, anim);
 
 			//Add the dust particle to the vector
-			m_dustParticles.push_back(d);
+			m_dustParticles.push_back({ d, dust });
 		}
 	}
 
 	//Loop through all dust particles and check if they need to be deleted
 	for (auto& dust : m_dustParticles)
 	{
-		auto dComp = static_cast<DustComponent*>(&dust->getComponent("Dust"));
+		auto dComp = dust.dust;
 
 		dComp->getTTL() -= dt;
 
@@ -65,18 +64,24 @@ void DustSystem::update(double dt)
 	{
 		for (auto& dust : m_dustToDelete)
 		{
-			(*m_systems)["Animation"]->deleteComponent(&dust->getComponent("Animation"));
-			(*m_systems)["Render"]->deleteComponent(&dust->getComponent("Sprite"));
-			m_dustParticles.erase(std::remove(m_dustParticles.begin(), m_dustParticles.end(), dust), m_dustParticles.end());
-
-			for (auto& c : dust->m_components)
-			{
-				delete c.second;
-			}
-
-			delete dust;
+			//The entity and its components go at the end of the frame
+			m_commandsPtr->destroy(dust.entity);
 		}
 
+		//Remove all of the expired dust in one pass
+		m_dustParticles.erase(std::remove_if(m_dustParticles.begin(), m_dustParticles.end(), [](const Particle& dust) {
+			return dust.dust->getTTL() <= 0;
+		}), m_dustParticles.end());
+
 		m_dustToDelete.clear();
 	}
 }
+
+void DustSystem::removeAllComponents()
+{
+	System::removeAllComponents();
+
+	//The dust entities belong to the match and are freed with it
+	m_dustParticles.clear();
+	m_dustToDelete.clear();
+}
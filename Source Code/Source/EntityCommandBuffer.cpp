@@ -0,0 +1,131 @@
+#include "EntityCommandBuffer.h"
+#include <algorithm>
+#include <unordered_map>
+
+EntityCommandBuffer::EntityCommandBuffer(EntityManager * entities) :
+	m_entitiesPtr(entities)
+{
+}
+
+EntityHandle EntityCommandBuffer::create(std::string id)
+{
+	auto handle = m_entitiesPtr->reserve();
+	m_creates.push_back({ handle, id });
+	return handle;
+}
+
+void EntityCommandBuffer::destroy(EntityHandle handle, bool keepComponents)
+{
+	m_destroys.push_back({ handle, keepComponents });
+}
+
+void EntityCommandBuffer::addComponent(System * system, Component * comp)
+{
+	m_ops.push_back({ system, comp, true });
+}
+
+void EntityCommandBuffer::removeComponent(System * system, Component * comp)
+{
+	m_ops.push_back({ system, comp, false });
+}
+
+/// <summary>
+/// Applies all of the recorded changes.
+/// New entities are made and given their components first.
+/// If a component was added and removed in the same
+/// frame the last one recorded wins, then each system
+/// gets one remove batch and one add batch
+/// </summary>
+void EntityCommandBuffer::flush()
+{
+	if (empty())
+		return;
+
+	for (auto& op : m_creates)
+	{
+		m_entitiesPtr->create(op.handle, op.id);
+	}
+	m_creates.clear();
+
+	for (auto& op : m_attaches)
+	{
+		auto entity = m_entitiesPtr->get(op.handle);
+		if (nullptr != entity)
+			op.add(*entity);
+		else
+			delete op.component; //The entity was destroyed before the flush, nothing owns the component
+	}
+	m_attaches.clear();
+
+	//Work out the final add or remove for every component, keeping everything in the order it was first recorded
+	//so the systems see the same order every run
+	struct Pending
+	{
+		std::vector<Component*> order;
+		std::unordered_map<Component*, bool> add;
+	};
+	std::vector<System*> systems;
+	std::unordered_map<System*, Pending> pending;
+
+	for (auto& op : m_ops)
+	{
+		auto it = pending.find(op.system);
+		if (it == pending.end())
+		{
+			systems.push_back(op.system);
+			it = pending.emplace(op.system, Pending()).first;
+		}
+
+		auto& p = it->second;
+		if (p.add.count(op.component) == 0)
+			p.order.push_back(op.component);
+		p.add[op.component] = op.add;
+	}
+	m_ops.clear();
+
+	std::vector<Component*> toAdd, toRemove;
+	for (auto system : systems)
+	{
+		auto& p = pending[system];
+		toAdd.clear();
+		toRemove.clear();
+
+		for (auto comp : p.order)
+		{
+			if (p.add[comp])
+				toAdd.push_back(comp);
+			else
+				toRemove.push_back(comp);
+		}
+
+		if (!toRemove.empty())
+			system->deleteComponents(toRemove);
+		if (!toAdd.empty())
+			system->addComponents(toAdd);
+	}
+
+	//Destroy entities last, their components are out of every system by now
+	for (auto& op : m_destroys)
+	{
+		m_entitiesPtr->destroy(op.handle, op.keepComponents);
+	}
+	m_destroys.clear();
+}
+
+void EntityCommandBuffer::clear()
+{
+	//The components were never given to an entity, so nothing else will delete them
+	std::vector<Component*> attached;
+	for (auto& op : m_attaches)
+		attached.push_back(op.component);
+	std::sort(attached.begin(), attached.end());
+	attached.erase(std::unique(attached.begin(), attached.end()), attached.end());
+	for (auto c : attached)
+		delete c;
+
+	m_entitiesPtr->cancelReservations();
+	m_creates.clear();
+	m_attaches.clear();
+	m_ops.clear();
+	m_destroys.clear();
+}
@@ -0,0 +1,152 @@
+#include "EntityManager.h"
+#include <cstdlib>
+#include <iostream>
+
+//Making entities out of the order they were reserved in would hand two of them the same slot, stop before that happens
+static void misusedReservations(const std::string& id, const char* message)
+{
+	std::cerr << "EntityManager can't make " << id << ": " << message << std::endl;
+	std::abort();
+}
+
+/// <summary>
+/// Creates an entity, reusing a
+/// free slot if there is one. Refuses while
+/// there are reserved slots that aren't made yet
+/// </summary>
+/// <param name="id">The id of the entity</param>
+/// <returns>Pointer to the entity, only valid until it is destroyed</returns>
+Entity * EntityManager::create(std::string id)
+{
+	if (m_reservedFree > 0 || m_reservedNew > 0)
+		misusedReservations(id, "there are reserved entities, flush the command buffer first");
+	return create(reserve(), id);
+}
+
+/// <summary>
+/// Picks the slot the next entity goes in, a free
+/// slot if there is one that isn't reserved yet
+/// or else one past the end of the slots
+/// </summary>
+/// <returns>The handle the entity will have once it is made</returns>
+EntityHandle EntityManager::reserve()
+{
+	if (m_reservedFree < m_free.size())
+	{
+		auto index = m_free[m_reservedFree++];
+		return EntityHandle(index, m_slots[index].generation);
+	}
+
+	//A new slot starts on the first generation
+	return EntityHandle(m_slots.size() + m_reservedNew++, Slot().generation);
+}
+
+/// <summary>
+/// Makes the entity in a reserved slot
+/// </summary>
+/// <param name="reserved">The handle from reserve, the oldest one not made yet</param>
+/// <param name="id">The id of the entity</param>
+/// <returns>Pointer to the entity, only valid until it is destroyed</returns>
+Entity * EntityManager::create(EntityHandle reserved, std::string id)
+{
+	auto index = reserved.index();
+
+	if (index < m_slots.size())
+	{
+		if (m_reservedFree == 0 || m_free.front() != index || m_slots[index].generation != reserved.generation())
+			misusedReservations(id, "the handle isn't the oldest reservation");
+		m_free.pop_front();
+		m_reservedFree--;
+	}
+	else
+	{
+		if (m_reservedNew == 0 || index != m_slots.size())
+			misusedReservations(id, "the handle isn't the oldest reservation");
+		m_slots.emplace_back();
+		m_reservedNew--;
+	}
+
+	auto& slot = m_slots[index];
+	slot.alive = true;
+	//Clear out whatever the last entity in this slot left behind
+	slot.entity.reset(id, EntityHandle(index, slot.generation));
+
+	return &slot.entity;
+}
+
+/// <summary>
+/// Forgets the handles given out by reserve
+/// that haven't been made, their slots are
+/// handed out again
+/// </summary>
+void EntityManager::cancelReservations()
+{
+	m_reservedFree = 0;
+	m_reservedNew = 0;
+}
+
+/// <summary>
+/// Destroys the entity the handle points to
+/// and deletes its components, they should be
+/// out of every system and the world by now.
+/// The packed components always go with it
+/// </summary>
+/// <param name="handle"></param>
+/// <param name="keepComponents">Leave the components for whoever made them to delete</param>
+void EntityManager::destroy(EntityHandle handle, bool keepComponents)
+{
+	if (valid(handle) == false)
+		return;
+
+	auto& slot = m_slots[handle.index()];
+	slot.alive = false;
+	removePacked(handle);
+	if (keepComponents == false)
+		slot.entity.deleteComponents();
+
+	//Bump the generation so old handles stop resolving, skip 0 so a null handle never matches
+	slot.generation = (slot.generation + 1) & EntityHandle::GENERATION_MASK;
+	if (slot.generation == 0)
+		slot.generation = 1;
+
+	m_free.push_back(handle.index());
+}
+
+/// <summary>
+/// Destroys every entity and deletes their
+/// components, the slots are kept for the next match
+/// </summary>
+void EntityManager::destroyAll()
+{
+	for (uint32_t i = 0; i < m_slots.size(); i++)
+	{
+		if (m_slots[i].alive)
+			destroy(EntityHandle(i, m_slots[i].generation));
+	}
+}
+
+void EntityManager::removePacked(EntityHandle handle)
+{
+	remove<PositionComponent>(handle);
+	remove<SpriteComponent>(handle);
+	remove<AnimationComponent>(handle);
+}
+
+/// <summary>
+/// Gets the entity the handle points to
+/// </summary>
+/// <param name="handle"></param>
+/// <returns>The entity or nullptr if it has been destroyed</returns>
+Entity * EntityManager::get(EntityHandle handle)
+{
+	return valid(handle) ? &m_slots[handle.index()].entity : nullptr;
+}
+
+bool EntityManager::valid(EntityHandle handle) const
+{
+	if (handle.isNull() || handle.index() >= m_slots.size())
+		return false;
+
+	auto& slot = m_slots[handle.index()];
+	return slot.alive && slot.generation == handle.generation();
+}
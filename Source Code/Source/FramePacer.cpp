@@ -0,0 +1,58 @@
+#include "FramePacer.h"
+#include <thread>
+#include "SDL.h"
+
+FramePacer::FramePacer(int targetFps) :
+	m_vsync(false),
+	m_focused(true),
+	m_deadline(Clock::now())
+{
+	setTargetFps(targetFps);
+}
+
+void FramePacer::setTargetFps(int fps)
+{
+	//0 or less means no limit
+	m_targetFrameTime = fps > 0 ? 1.0 / fps : 0;
+}
+
+void FramePacer::setFocused(bool focused)
+{
+	m_focused = focused;
+	m_deadline = Clock::now();
+}
+
+double FramePacer::frameTime() const
+{
+	if (m_focused == false)
+		return 1.0 / BACKGROUND_FPS;
+	return m_vsync ? 0 : m_targetFrameTime;
+}
+
+/// <summary>
+/// Sleeps then spins until the
+/// deadline for this frame
+/// </summary>
+void FramePacer::wait()
+{
+	auto frame = frameTime();
+	if (frame <= 0)
+		return;
+
+	m_deadline += std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(frame));
+	auto now = Clock::now();
+
+	//A long frame put us behind, start again from now instead of rushing the next few frames to catch up
+	if (m_deadline < now)
+	{
+		m_deadline = now;
+		return;
+	}
+
+	auto left = std::chrono::duration<double>(m_deadline - now).count();
+	if (left > SPIN_TIME)
+		SDL_Delay((Uint32)((left - SPIN_TIME) * 1000));
+
+	while (Clock::now() < m_deadline)
+		std::this_thread::yield();
+}
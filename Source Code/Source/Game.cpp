@@ -1,29 +1,27 @@
 #include "Game.h"
 #include "SDL_mixer.h"
 #include "AchievementComponent.h"
+#include <algorithm>
+#include <cmath>
 
-std::vector<Observer*> achi::Listener::obs = {};
-Component* achi::Listener::m_AchisPtr = nullptr;
-std::vector<std::string> achi::Listener::m_newUnlocks = {};
-int achi::Listener::m_localPlayers = 0;
-bool achi::Listener::m_exit = false;
-
-Game::Game(int fps) :
-	m_msPerFrame(fps / 60.0f), //Get the target fps
+Game::Game(int fps, bool vsync) :
 	m_window(NULL),
 	m_screenSurface(NULL),
+	m_vsync(vsync),
 	m_quit(false),
+	m_pacer(fps),
+	m_stepTime(0),
 	m_resources("./Resources/")
 {
-	//Create our systems and add them to our system map
-	m_systems["Render"] = new RenderSystem();
-	m_systems["Animation"] = new AnimationSystem();
-	m_systems["Input"] = new InputSystem();
-	m_systems["Physics"] = new PhysicsSystem();
-	m_systems["Player Physics"] = new PlayerPhysicsSystem();
-	m_systems["AI"] = new AISystem();
-	m_systems["Network"] = new OnlineSystem();
-	m_systems["Pickup"] = new PickUpSystem(m_systems["Render"], static_cast<OnlineSystem*>(m_systems["Network"]));
+	//Create our systems and add them to the registry
+	m_systems.add(new RenderSystem());
+	m_systems.add(new AnimationSystem());
+	m_inputSystem = m_systems.add(new InputSystem());
+	m_systems.add(new PhysicsSystem());
+	m_systems.add(new PlayerPhysicsSystem());
+	m_systems.add(new AISystem());
+	m_onlineSystem = m_systems.add(new OnlineSystem());
+	m_systems.add(new PickUpSystem(m_onlineSystem));
 }
 
 void Game::update(double dt)
@@ -41,6 +39,9 @@ void Game::draw()
 	m_mManager.draw(*m_renderer);
 	//testSystem->render(*m_renderer);
 
+	//Frame timings go on top of everything
+	m_profilerOverlay.draw(*m_renderer);
+
 	//Render everything drawn to the renderer
 	SDL_RenderPresent(m_renderer);
 }
@@ -57,6 +58,15 @@ void Game::processEvents(SDL_Event& e)
 			m_quit = true;
 		}
 
+		//Slow right down while the window is in the background
+		if (e.type == SDL_WINDOWEVENT)
+		{
+			if (e.window.event == SDL_WINDOWEVENT_FOCUS_LOST || e.window.event == SDL_WINDOWEVENT_MINIMIZED)
+				m_pacer.setFocused(false);
+			else if (e.window.event == SDL_WINDOWEVENT_FOCUS_GAINED || e.window.event == SDL_WINDOWEVENT_RESTORED)
+				m_pacer.setFocused(true);
+		}
+
 		//If keydown event
 		if (e.type == SDL_KEYDOWN)
 		{
@@ -66,10 +76,25 @@ void Game::processEvents(SDL_Event& e)
 				//Exit game
 				m_quit = true;
 			}
+			//Profiler keys
+			else if (e.key.keysym.sym == SDLK_F3 && e.key.repeat == 0)
+				m_profilerOverlay.toggle();
+			else if (e.key.keysym.sym == SDLK_F4 && e.key.repeat == 0)
+				toggleTrace("frame_trace.json");
+			else if (e.key.keysym.sym == SDLK_F5 && e.key.repeat == 0)
+				toggleTrace("frame_trace.csv");
 		}
 	}
 }
 
+void Game::toggleTrace(const std::string& path)
+{
+	auto& profiler = Profiler::instance();
+	if (profiler.tracing())
+		profiler.stopTrace();
+	else
+		profiler.startTrace(path);
+}
 
 void Game::run()
 {
@@ -77,34 +102,68 @@ void Game::run()
 	//Create our SDL event variable
 	SDL_Event e;
 	double dt = 0;
-	auto now = std::chrono::system_clock::now();
-	auto before = std::chrono::system_clock::now();
+	//Steady clock so changes to the system time can't make dt jump or go negative
+	auto now = std::chrono::steady_clock::now();
+	auto before = std::chrono::steady_clock::now();
+	auto& profiler = Profiler::instance();
 
 	//While our bool is false, loop indefinitely
 	while (!m_quit)
 	{
-		m_quit = achi::Listener::m_exit;
-		now = std::chrono::system_clock::now();
+		profiler.beginFrame();
+		m_quit = m_mManager.exiting();
+		now = std::chrono::steady_clock::now();
 		dt = std::chrono::duration<double>(now - before).count();
-		//Process any events that have occured
-		processEvents(e);
+		{
+			//Process any events that have occured
+			PROFILE_ZONE("Events");
+			processEvents(e);
+		}
+
+		//Run as many fixed steps as the time passed covers
+		m_stepTime += std::min(dt, MAX_FRAME_TIME);
+		int steps = 0;
+		while (m_stepTime >= STEP_TIME && steps < MAX_STEPS)
+		{
+			{
+				//handle input in the scenes
+				PROFILE_ZONE("Input");
+				m_mManager.handleInput(*m_inputSystem);
+			}
 
-		//Get the input system and pass it to the handleInput
-		auto input = static_cast<InputSystem*>(m_systems["Input"]);
+			{
+				//update networked aspects
+				PROFILE_ZONE("Online");
+				m_onlineSystem->update(STEP_TIME);
+			}
 
-		//handle input in the scenes
-		m_mManager.handleInput(*input);
+			{
+				//Update the game
+				PROFILE_ZONE("Update");
+				update(STEP_TIME);
+			}
 
-		//update networked aspects
-		auto net = static_cast<OnlineSystem*>(m_systems["Network"]);
-		net->update(dt);
+			m_stepTime -= STEP_TIME;
+			steps++;
+		}
 
-		//Update the game
-		update(dt);
+		//Couldn't keep up, drop the backlog instead of trying to catch up next frame
+		if (m_stepTime >= STEP_TIME)
+			m_stepTime = std::fmod(m_stepTime, STEP_TIME);
 
-		//Draw the Game
-		draw();
-		
+		{
+			//Draw the Game, blending positions by how far we are into the next step
+			PROFILE_ZONE("Draw");
+			m_systems.get<RenderSystem>()->setInterpolation((float)(m_stepTime / STEP_TIME));
+			draw();
+		}
+
+		{
+			//Wait for the next frame instead of spinning
+			PROFILE_ZONE("Pace");
+			m_pacer.wait();
+		}
+		profiler.endFrame();
 
 		//Make before time equal to the current time
 		before = now;
@@ -152,7 +211,12 @@ bool Game::init()
 			if( !( IMG_Init( imgFlags ) & imgFlags ) )
 			{ printf( "SDL_image could not initialize! SDL_image Error: %s\n", IMG_GetError() ); }
 
-			m_renderer = SDL_CreateRenderer(m_window, -1, SDL_RENDERER_ACCELERATED);
+			m_renderer = SDL_CreateRenderer(m_window, -1, SDL_RENDERER_ACCELERATED | (m_vsync ? SDL_RENDERER_PRESENTVSYNC : 0));
+
+			//The driver can turn vsync down, only leave the pacing to it if it's really on
+			SDL_RendererInfo info;
+			if (NULL != m_renderer && SDL_GetRendererInfo(m_renderer, &info) == 0)
+				m_pacer.setVsync((info.flags & SDL_RENDERER_PRESENTVSYNC) != 0);
 			//Get window surface
 			m_screenSurface = SDL_GetWindowSurface(m_window);
 		}
@@ -173,7 +237,6 @@ bool Game::loadMedia()
 
 	//Setup the achievement component
 	m_mManager.m_scenes["Achievements"]->achievements().setAchievementData(&m_resources.getAchievementData());
-	achi::Listener::m_AchisPtr = &m_mManager.m_scenes["Achievements"]->achievements();
 
 	//Set the scene after the systems ptr has been set and the resource manager has been passed over
 	m_mManager.setScene("Main Menu");
@@ -183,6 +246,9 @@ bool Game::loadMedia()
 
 void Game::close()
 {
+	//Don't lose a trace that's still running
+	Profiler::instance().stopTrace();
+
 	//Destroy window
 	SDL_DestroyWindow(m_window);
 	m_window = NULL;
@@ -0,0 +1,167 @@
+#include "MatchInstance.h"
+#include "MatchRunner.h"
+#include "PhysicsTaskPool.h"
+#include "Profiler.h"
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#ifndef CYBERPUNCH_LEVEL_PATH
+#define CYBERPUNCH_LEVEL_PATH "./Resources/LevelData.txt"
+#endif
+
+//Prints how a match ended and the hash of where everything ended up
+static void report(int index, MatchInstance& match)
+{
+	std::cout << "match " << index << ": ";
+	if (match.isOver() == false)
+		std::cout << "stopped with " << match.playersLeft() << " players left";
+	else if (match.winner() < 0)
+		std::cout << "draw";
+	else
+		std::cout << "player " << match.winner() << " won";
+	std::cout << " after " << match.elapsed() << "s sim, " << match.steps() << " steps, state " << std::hex << match.stateHash() << std::dec;
+}
+
+//Runs matches with no window, as fast as the machine can step them.
+//cyberpunch_headless [--matches N] [--bots B] [--seed S] [--level path] [--max-seconds S] [--replay path] [--threads T] [--physics-threads P]
+//Bot matches are seeded with the seed plus the match number. With more than one thread the bot matches are all
+//run at once on a MatchRunner, otherwise they are run back to back and the profiler's zones are printed at the end.
+//A replay is played the given number of times, back to back, it ends with the match or when its recorded input runs out.
+//With more than one physics thread each match solves its Box2D islands on a pool of that many threads
+int main(int argc, char* argv[])
+{
+	const double STEP_TIME = 1.0 / 120.0; //Same fixed step as the game
+	int matches = 1;
+	int bots = 4;
+	double maxSeconds = 300;
+	uint64_t seed = 1;
+	int threads = 1;
+	int physicsThreads = 1;
+	std::string levelPath = CYBERPUNCH_LEVEL_PATH;
+	std::string replayPath;
+
+	for (int i = 1; i < argc; i++)
+	{
+		auto hasValue = i + 1 < argc;
+		if (strcmp(argv[i], "--matches") == 0 && hasValue)
+			matches = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--bots") == 0 && hasValue)
+			bots = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--level") == 0 && hasValue)
+			levelPath = argv[++i];
+		else if (strcmp(argv[i], "--max-seconds") == 0 && hasValue)
+			maxSeconds = atof(argv[++i]);
+		else if (strcmp(argv[i], "--seed") == 0 && hasValue)
+			seed = strtoull(argv[++i], nullptr, 10);
+		else if (strcmp(argv[i], "--replay") == 0 && hasValue)
+			replayPath = argv[++i];
+		else if (strcmp(argv[i], "--threads") == 0 && hasValue)
+			threads = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--physics-threads") == 0 && hasValue)
+			physicsThreads = atoi(argv[++i]);
+		else
+		{
+			std::cout << "Usage: " << argv[0] << " [--matches N] [--bots B] [--seed S] [--level path] [--max-seconds S] [--replay path] [--threads T] [--physics-threads P]" << std::endl;
+			return 1;
+		}
+	}
+
+	if (matches < 1 || threads < 1 || physicsThreads < 1 || (replayPath.empty() && bots < 2))
+	{
+		std::cout << "Need at least 1 match, 1 thread and 2 bots" << std::endl;
+		return 1;
+	}
+
+	std::ifstream ifs(levelPath);
+	if (ifs.is_open() == false)
+	{
+		std::cout << "Unable to open level " << levelPath << std::endl;
+		return 1;
+	}
+	std::string content((std::istreambuf_iterator<char>(ifs)), (std::istreambuf_iterator<char>()));
+	auto level = json::parse(content);
+
+	Replay replay;
+	if (replayPath.empty() == false)
+	{
+		if (replay.load(replayPath) == false)
+			return 1;
+		if (replay.levelHash() != Replay::hashLevel(level))
+		{
+			std::cout << "Replay was recorded on a different level" << std::endl;
+			return 1;
+		}
+		std::cout << "Playing " << replayPath << ": " << replay.players().size() << " players, " << replay.ticks() << " ticks, seed " << replay.seed() << std::endl;
+	}
+
+	long long totalSteps = 0;
+	double totalSimSeconds = 0;
+	auto start = std::chrono::steady_clock::now();
+
+	//The thread stepping a match does a share of its islands, so the pool has one less
+	WorkerPool physicsWorkers(physicsThreads - 1);
+	PhysicsTaskPool physicsTasks(physicsWorkers);
+	b2TaskPool* taskPool = physicsThreads > 1 ? &physicsTasks : nullptr;
+
+	if (threads > 1 && replayPath.empty())
+	{
+		MatchRunner runner(threads);
+		for (int m = 0; m < matches; m++)
+		{
+			auto match = new MatchInstance(level, bots, seed + m);
+			match->setTaskPool(taskPool);
+			runner.add(match);
+		}
+
+		runner.run(STEP_TIME, maxSeconds);
+
+		for (int m = 0; m < matches; m++)
+		{
+			auto& match = *runner.matches()[m];
+			report(m, match);
+			std::cout << std::endl;
+
+			totalSteps += match.steps();
+			totalSimSeconds += match.elapsed();
+		}
+	}
+	else
+	{
+		for (int m = 0; m < matches; m++)
+		{
+			auto matchStart = std::chrono::steady_clock::now();
+			std::unique_ptr<MatchInstance> playing(replayPath.empty() ? new MatchInstance(level, bots, seed + m) : new MatchInstance(level, replay));
+			auto& match = *playing;
+			match.setTaskPool(taskPool);
+
+			while (match.isOver() == false && match.elapsed() < maxSeconds && (replayPath.empty() || replay.finished() == false))
+			{
+				Profiler::instance().beginFrame();
+				match.update(STEP_TIME);
+				Profiler::instance().endFrame();
+			}
+
+			auto wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - matchStart).count();
+			report(m, match);
+			std::cout << " in " << wall << "s" << std::endl;
+
+			totalSteps += match.steps();
+			totalSimSeconds += match.elapsed();
+		}
+	}
+
+	auto wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	std::cout << matches << " matches, " << totalSteps << " steps in " << wall << "s: "
+		<< totalSteps / wall << " steps/s, " << totalSimSeconds / wall << "x real time" << std::endl;
+
+	//Matches on the runner aren't profiled
+	for (auto& zone : Profiler::instance().stats())
+		std::cout << "  " << zone.name << " p50 " << zone.p50 << "ms p99 " << zone.p99 << "ms" << std::endl;
+
+	return 0;
+}
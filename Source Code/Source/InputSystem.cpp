@@ -1,8 +1,8 @@
-#include "..\Header\InputSystem.h"
+#include "InputSystem.h"
 
 void InputSystem::addComponent(Component * component)
 {
-	m_components.push_back(component);
+	insertComponent(component);
 }
 
 void InputSystem::update(double dt)
@@ -3,7 +3,7 @@
 int main(int argc, char* args[])
 {
 	//Create new game objetc with target fps of 60
-	auto game = Game(60);
+	Game game(60);
 
 	//If the game didnt fail to initialise
 	if (game.init())
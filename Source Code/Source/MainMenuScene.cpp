@@ -1,5 +1,6 @@
 #include "MainMenuScene.h"
 #include "RenderSystem.h"
+#include "AnimationSystem.h"
 #include "AnimationComponent.h"
 
 MainMenuScene::MainMenuScene() :
@@ -46,8 +47,8 @@ void MainMenuScene::start()
 	m_buttons.push_back(createButton(Vector2f(960, 445 + 135 * 4), Scene::resources().getTexture("Exit Button"), "Exit", m_currentIndex == 4 ? true : false));
 
 
-	Scene::systems()["Render"]->addComponent(&m_logo.getComponent("Sprite"));
-	Scene::systems()["Animation"]->addComponent(&m_logo.getComponent("Animation"));
+	Scene::systems().get<RenderSystem>()->addComponent(&m_logo.getComponent("Sprite"));
+	Scene::systems().get<AnimationSystem>()->addComponent(&m_logo.getComponent("Animation"));
 
 	m_audioCreated = true;
 }
@@ -57,15 +58,15 @@ void MainMenuScene::stop()
 	//Remove components from systems
 	for (auto& btn : m_buttons)
 	{
-		Scene::systems()["Render"]->deleteComponent(&btn->getComponent("Sprite"));
-		Scene::systems()["Render"]->deleteComponent(&btn->getComponent("Text Sprite"));
-		Scene::systems()["Animation"]->deleteComponent(&btn->getComponent("Animation"));
-		Scene::systems()["Animation"]->deleteComponent(&btn->getComponent("Text Animation"));
+		Scene::systems().get<RenderSystem>()->deleteComponent(&btn->getComponent("Sprite"));
+		Scene::systems().get<RenderSystem>()->deleteComponent(&btn->getComponent("Text Sprite"));
+		Scene::systems().get<AnimationSystem>()->deleteComponent(&btn->getComponent("Animation"));
+		Scene::systems().get<AnimationSystem>()->deleteComponent(&btn->getComponent("Text Animation"));
 	}
 
 	//Remove logo from the systems
-	Scene::systems()["Render"]->deleteComponent(&m_logo.getComponent("Sprite"));
-	Scene::systems()["Animation"]->deleteComponent(&m_logo.getComponent("Animation"));
+	Scene::systems().get<RenderSystem>()->deleteComponent(&m_logo.getComponent("Sprite"));
+	Scene::systems().get<AnimationSystem>()->deleteComponent(&m_logo.getComponent("Animation"));
 
 	//Only stop the menu music if we are going into the game
 	if(Scene::getStgt() == "Game")
@@ -74,7 +75,7 @@ void MainMenuScene::stop()
 	m_buttons.clear();
 }
 
-Entity* MainMenuScene::createButton(Vector2f position, SDL_Texture* selectedTexture, std::string btnTag, bool selected)
+Entity* MainMenuScene::createButton(Vector2f position, TextureRegion selectedTexture, std::string btnTag, bool selected)
 {
 	auto btn = new Entity("Button");
 	auto pos = new PositionComponent(position.x, position.y);
@@ -110,10 +111,10 @@ Entity* MainMenuScene::createButton(Vector2f position, SDL_Texture* selectedText
 
 
 	//Add sprite component to the render system
-	Scene::systems()["Render"]->addComponent(&btn->getComponent("Sprite"));
-	Scene::systems()["Render"]->addComponent(&btn->getComponent("Text Sprite"));
-	Scene::systems()["Animation"]->addComponent(anim);
-	Scene::systems()["Animation"]->addComponent(textAnim);
+	Scene::systems().get<RenderSystem>()->addComponent(&btn->getComponent("Sprite"));
+	Scene::systems().get<RenderSystem>()->addComponent(&btn->getComponent("Text Sprite"));
+	Scene::systems().get<AnimationSystem>()->addComponent(anim);
+	Scene::systems().get<AnimationSystem>()->addComponent(textAnim);
 
 	//Return the created btn
 	return btn;
@@ -121,7 +122,7 @@ Entity* MainMenuScene::createButton(Vector2f position, SDL_Texture* selectedText
 
 void MainMenuScene::update(double dt)
 {
-	Scene::systems()["Animation"]->update(dt);
+	Scene::systems().get<AnimationSystem>()->update(dt);
 
 	m_logoTimer -= dt;
 
@@ -136,13 +137,13 @@ void MainMenuScene::update(double dt)
 void MainMenuScene::draw(SDL_Renderer & renderer)
 {
 	//Draw everything in the render system
-	static_cast<RenderSystem*>(Scene::systems()["Render"])->render(renderer, m_camera);
+	Scene::systems().get<RenderSystem>()->render(renderer, m_camera);
 }
 
 void MainMenuScene::handleInput(InputSystem& input)
 {
 	//Update the input system
-	Scene::systems()["Input"]->update(0);
+	Scene::systems().get<InputSystem>()->update(0);
 
 	//If the main menu input component is not added to the system, add it
 	if (!m_addedInput)
@@ -222,6 +223,6 @@ void MainMenuScene::handleButtonPressed()
 	}
 	else if (tag == "Exit")
 	{
-		achi::Listener::m_exit = true;
+		exitGame();
 	}
 }
@@ -0,0 +1,332 @@
+#include "MatchBuilder.h"
+#include "AISystem.h"
+#include "AnimationSystem.h"
+#include "AttackSystem.h"
+#include "AudioComponent.h"
+#include "DJBoothSystem.h"
+#include "DustTriggerComponent.h"
+#include "GravityBoothComponent.h"
+#include "OnlineInputComponent.h"
+#include "PhysicsSystem.h"
+#include "PickUpSystem.h"
+#include "PlatformBoothComponent.h"
+#include "PlatformComponent.h"
+#include "PlayerComponent.h"
+#include "PlayerInputComponent.h"
+#include "PlayerPhysicsSystem.h"
+#include "PlayerRespawnSystem.h"
+#include "SlowBoothComponent.h"
+#include "SpriteComponent.h"
+#ifndef CYBERPUNCH_HEADLESS
+#include "ResourceManager.h"
+#endif
+#include <algorithm>
+
+MatchBuilder::MatchBuilder(EntityManager& entities, EntityCommandBuffer& commands, Box2DBridge& world, CollisionListener& collisions,
+	Random& random, achi::Listener& events, std::vector<Entity*>& players, std::vector<Entity*>& platforms) :
+	m_entitiesPtr(&entities),
+	m_commandsPtr(&commands),
+	m_worldPtr(&world),
+	m_collisionsPtr(&collisions),
+	m_randomPtr(&random),
+	m_eventsPtr(&events),
+	m_playersPtr(&players),
+	m_platformsPtr(&platforms),
+	m_systemsPtr(nullptr),
+	m_resourcesPtr(nullptr),
+	m_pickUp(nullptr)
+{
+}
+
+/// <summary>
+/// Builds the whole match, the world has to be made
+/// and the match systems added to the registry first
+/// </summary>
+void MatchBuilder::create(const json& level, const std::vector<Replay::Player>& slots, SystemRegistry& systems, ResourceHandler* resources)
+{
+	m_systemsPtr = &systems;
+	m_resourcesPtr = resources;
+	//The positions, sprites and animations are packed in the entity manager, the animation and physics systems walk them there
+	systems.get<AnimationSystem>()->setEntities(m_entitiesPtr);
+	systems.get<PhysicsSystem>()->setEntities(m_entitiesPtr);
+	systems.get<PlayerPhysicsSystem>()->setEntities(m_entitiesPtr);
+
+	m_spawnPositions.clear();
+	for (auto& point : level["Spawn Points"])
+		m_spawnPositions.push_back(Vector2f(point["X"], point["Y"]));
+
+	for (auto& slot : slots)
+		m_playersPtr->push_back(createPlayer(slot.type, slot.index));
+
+	m_pickUp = createPickUp();
+
+	//The last booth goes in with the platforms
+	auto& booths = level["Booth"];
+	for (int i = 0; i < (int)booths.size() - 1; i++)
+		m_booths.push_back(createDJB(i, booths.at(i)["X"], booths.at(i)["Y"]));
+
+	for (auto& kb : level["Kill Boxes"])
+		createKillBox(kb["X"], kb["Y"], kb["W"], kb["H"]);
+
+	createPlatforms(level);
+	m_booths.push_back(createDJB(2, booths.at(2)["X"], booths.at(2)["Y"]));
+}
+
+/// <summary>
+/// Makes a local, online or AI player, the caller hooks the
+/// input up to the keyboard, joycons or network if there are any
+/// </summary>
+Entity* MatchBuilder::createPlayer(Replay::PlayerType type, int index)
+{
+	//More players than spawn points share them, the first four get a spot each
+	auto& spawn = m_spawnPositions.at(index % m_spawnPositions.size());
+
+	auto p = m_entitiesPtr->create(type == Replay::BOT ? "AI" : "Player");
+	auto player = new PlayerComponent(m_spawnPositions, p, index, m_entitiesPtr, *m_randomPtr);
+	player->setListener(m_eventsPtr);
+
+	m_entitiesPtr->add<PositionComponent>(p->handle(), 0, 0);
+	p->addComponent("Player", player);
+	p->addComponent("Dust Trigger", new DustTriggerComponent());
+	p->addComponent("Attack", new AttackComponent());
+	m_entitiesPtr->add<SpriteComponent>(p->handle(), nullptr, Vector2f(1700, 85), Vector2f(85, 85), texture("Player Idle" + std::to_string(index)), 2);
+	auto audio = new AudioComponent();
+	addSounds(*audio, { "Spawn", "KnockOut", "Punch", "Jump", "Whoosh", "Footsteps" });
+	p->addComponent("Audio", audio);
+
+	if (type == Replay::BOT)
+	{
+		auto input = new AiInputComponent();
+		p->addComponent("Input", input);
+		p->set<ControlComponent>(input);
+		p->addComponent("AI", new AIComponent(m_playersPtr, input, p, player, m_entitiesPtr));
+		m_systemsPtr->get<AISystem>()->addComponent(&p->getComponent("AI"));
+	}
+	else if (type == Replay::LOCAL)
+	{
+		auto input = new PlayerInputComponent();
+		input->m_playerNumber = index;
+		p->addComponent("Input", input);
+		p->set<ControlComponent>(input);
+	}
+	else
+	{
+		auto input = new OnlineInputComponent();
+		input->m_playerNumber = index;
+		p->addComponent("Input", input);
+		p->set<ControlComponent>(input);
+	}
+
+	std::vector<SDL_Rect> animRects, stunRects;
+	for (int i = 0; i < 20; i++)
+	{
+		if (i < 10)
+			stunRects.push_back({ 85 * i, 0, 85, 85 });
+		animRects.push_back({ 85 * i, 0, 85, 85 });
+	}
+
+	//The animations run headless too, the attacks and stuns are timed off them
+	auto number = std::to_string(index);
+	auto animation = &m_entitiesPtr->add<AnimationComponent>(p->handle(), nullptr);
+	animation->addAnimation("Run", texture("Player Run" + number), animRects, .75f);
+	animation->addAnimation("Idle", texture("Player Idle" + number), animRects, .5f);
+	animation->addAnimation("Punch 0", texture("Player Left Punch" + number), animRects, .175f);
+	animation->addAnimation("Punch 1", texture("Player Right Punch" + number), animRects, .175f);
+	animation->addAnimation("Ground Kick", texture("Player Ground Kick" + number), animRects, .4f);
+	animation->addAnimation("Uppercut", texture("Player Uppercut" + number), animRects, .4f);
+	animation->addAnimation("Jump", texture("Player Jump" + number), animRects, .4f);
+	animation->addAnimation("Super Stun", texture("Player Super Stun" + number), stunRects, .25f);
+	animation->addAnimation("Small Stun", texture("Player Small Stun" + number), stunRects, .25f);
+	animation->addAnimation("Big Stun", texture("Player Big Stun" + number), stunRects, .25f);
+	animation->playAnimation("Idle", true);
+
+	m_systemsPtr->get<AttackSystem>()->addComponent(&p->getComponent("Attack"));
+	m_systemsPtr->get<PlayerRespawnSystem>()->addComponent(player);
+
+	//Create the physics component and set up the bodies
+	auto phys = new PlayerPhysicsComponent(p);
+	phys->createBody(*m_worldPtr, spawn.x, spawn.y, p);
+	if (type == Replay::BOT)
+		p->get<AIComponent>()->createEdgeSensors(*m_worldPtr, *phys->m_body);
+	p->get<AttackComponent>()->createHitboxes(*m_worldPtr, *p);
+
+	p->addComponent("Player Physics", phys);
+	m_systemsPtr->get<PlayerPhysicsSystem>()->addComponent(phys);
+
+	return p;
+}
+
+/// <summary>
+/// The record, it has no body until the pickup system spawns it
+/// </summary>
+Entity* MatchBuilder::createPickUp()
+{
+	auto pickUp = m_entitiesPtr->create("PickUp");
+	m_entitiesPtr->add<PositionComponent>(pickUp->handle(), 0, 0);
+	pickUp->addComponent("PickUp", new PickUpComponent(pickUp, *m_randomPtr));
+	auto& sprite = m_entitiesPtr->add<SpriteComponent>(pickUp->handle(), nullptr, Vector2f(1500, 50), Vector2f(50, 50), texture("Record"), 1);
+	sprite.isVisible() = false; //Shown by the pickup system while it's out
+
+	auto& anim = m_entitiesPtr->add<AnimationComponent>(pickUp->handle(), nullptr);
+	std::vector<SDL_Rect> spinAnimation;
+	for (int i = 0; i < 30; i++)
+		spinAnimation.push_back({ i * 50, 0, 50, 50 });
+	anim.addAnimation("Spin", texture("Record"), spinAnimation, 1.75f);
+	anim.playAnimation("Spin", true);
+	m_systemsPtr->get<PickUpSystem>()->addComponent(&pickUp->getComponent("PickUp"));
+
+	auto audio = new AudioComponent();
+	addSounds(*audio, { "PickUp 1" });
+	pickUp->addComponent("Audio", audio);
+	return pickUp;
+}
+
+/// <summary>
+/// Index 0 is the gravity booth, 1 the slow motion booth
+/// and 2 the booth that moves the platforms
+/// </summary>
+Entity* MatchBuilder::createDJB(int index, int posX, int posY)
+{
+	auto booth = m_entitiesPtr->create("Booth");
+	m_entitiesPtr->add<PositionComponent>(booth->handle(), posX, posY); //Where the body is, so the render grid can place it before the first step
+
+	auto phys = new PhysicsComponent(booth);
+	phys->m_body = m_worldPtr->createBox(posX, posY, 150, 50, false, false, b2BodyType::b2_staticBody);
+	m_worldPtr->addProperties(*phys->m_body, 1, 0.05f, 0.0f, true, new PhysicsComponent::ColData("Booth", booth));
+	booth->addComponent("Physics", phys);
+	m_systemsPtr->get<PhysicsSystem>()->addComponent(phys);
+	m_entitiesPtr->add<SpriteComponent>(booth->handle(), nullptr, Vector2f(152, 93), Vector2f(152, 93), texture("Booth" + std::to_string(index)), 1);
+	auto audio = new AudioComponent();
+	addSounds(*audio, { "Switch", "Switch2" });
+	booth->addComponent("Audio", audio);
+
+	if (index == 0)
+		booth->addComponent<DJBoothComponent>("DJ Booth", new GravityBoothComponent(*m_playersPtr, m_entitiesPtr, m_worldPtr, m_systemsPtr->get<PlayerPhysicsSystem>(), m_collisionsPtr, m_pickUp));
+	else if (index == 1)
+		booth->addComponent<DJBoothComponent>("DJ Booth", new SlowBoothComponent(m_pickUp));
+	else
+		booth->addComponent<DJBoothComponent>("DJ Booth", new PlatformBoothComponent(m_platformsPtr, m_pickUp));
+
+	booth->get<DJBoothComponent>()->setListener(m_eventsPtr);
+	m_systemsPtr->get<DJBoothSystem>()->addComponent(&booth->getComponent("DJ Booth"));
+	return booth;
+}
+
+Entity* MatchBuilder::createKillBox(int posX, int posY, int width, int height)
+{
+	auto kb = m_entitiesPtr->create("KillBox");
+	m_entitiesPtr->add<PositionComponent>(kb->handle(), 0, 0);
+	auto phys = new PhysicsComponent(kb);
+	phys->m_body = m_worldPtr->createBox(posX, posY, width, height, false, false, b2_staticBody);
+	m_worldPtr->addProperties(*phys->m_body, 0, 0, 0, true, new PhysicsComponent::ColData("Kill Box", kb));
+	kb->addComponent("Physics", phys);
+	m_systemsPtr->get<PhysicsSystem>()->addComponent(phys);
+	return kb;
+}
+
+/// <summary>
+/// Creates the platforms from the level data,
+/// the platform booth moves them about
+/// </summary>
+void MatchBuilder::createPlatforms(const json& level)
+{
+	for (auto& platform : level["Platforms"])
+	{
+		int x = platform["X"], y = platform["Y"], w = platform["W"], h = platform["H"], angle = platform["Angle"];
+		std::string tag = platform["Tag"];
+
+		auto newPlat = m_entitiesPtr->create(tag);
+		auto platComp = new PlatformComponent();
+		m_entitiesPtr->add<PositionComponent>(newPlat->handle(), x, y);
+		newPlat->addComponent("Platform", platComp);
+		auto phys = new PhysicsComponent(newPlat);
+		phys->m_body = m_worldPtr->createBox(x, y, angle != 90 ? w : h, angle != 90 ? h : w, false, true, b2BodyType::b2_staticBody);
+		m_worldPtr->addProperties(*phys->m_body, 0, .1f, 0, false, new PhysicsComponent::ColData(tag, newPlat));
+		newPlat->addComponent("Physics", phys);
+		m_systemsPtr->get<PhysicsSystem>()->addComponent(phys);
+
+#ifndef CYBERPUNCH_HEADLESS
+		//The textures are built the first time a platform of this size is seen and shared after that
+		if (nullptr != m_resourcesPtr)
+		{
+			platComp->setGreen(m_resourcesPtr->getPlatformTexture(w, h, tag, "Green"));
+			platComp->setBlue(m_resourcesPtr->getPlatformTexture(w, h, tag, "Blue"));
+			platComp->setPink(m_resourcesPtr->getPlatformTexture(w, h, tag, "Pink"));
+			platComp->setOrange(m_resourcesPtr->getPlatformTexture(w, h, tag, "Orange"));
+		}
+#endif
+
+		//Starts on the green platform texture
+		auto& sprite = m_entitiesPtr->add<SpriteComponent>(newPlat->handle(), nullptr, Vector2f(w, h), Vector2f(w, h), platComp->getTexture("Game BG0"), 1);
+		sprite.setAngle(angle);
+		m_platformsPtr->push_back(newPlat);
+	}
+}
+
+void MatchBuilder::removePlayer(Entity* player)
+{
+	auto phys = player->get<PlayerPhysicsComponent>();
+	m_commandsPtr->removeComponent(m_systemsPtr->get<AttackSystem>(), player->get<AttackComponent>());
+	m_commandsPtr->removeComponent(m_systemsPtr->get<PlayerPhysicsSystem>(), phys);
+	m_commandsPtr->removeComponent(m_systemsPtr->get<PlayerRespawnSystem>(), player->get<PlayerComponent>());
+
+	//Destroyed now rather than at the next update, destroying it ends its contacts and the listener
+	//follows the ColData back to this player, whose components go at the flush
+	m_worldPtr->destroyBody(*phys->m_body);
+
+	if (player->m_ID == "AI")
+		m_commandsPtr->removeComponent(m_systemsPtr->get<AISystem>(), player->get<AIComponent>());
+
+	//The hitbox bodies point back at the player, so they have to go with it
+	player->get<AttackComponent>()->releaseHitboxes(*m_worldPtr);
+
+	m_playersPtr->erase(std::remove(m_playersPtr->begin(), m_playersPtr->end(), player), m_playersPtr->end());
+	m_commandsPtr->destroy(player->handle());
+}
+
+void MatchBuilder::destroy()
+{
+	if (nullptr != m_systemsPtr)
+	{
+		m_systemsPtr->get<PlayerPhysicsSystem>()->removeAllComponents();
+		m_systemsPtr->get<PlayerPhysicsSystem>()->setEntities(nullptr);
+		m_systemsPtr->get<PhysicsSystem>()->removeAllComponents();
+		m_systemsPtr->get<PhysicsSystem>()->setEntities(nullptr);
+		m_systemsPtr->get<PickUpSystem>()->removeAllComponents();
+		m_systemsPtr->get<AttackSystem>()->removeAllComponents();
+		m_systemsPtr->get<AISystem>()->removeAllComponents();
+		m_systemsPtr->get<PlayerRespawnSystem>()->removeAllComponents();
+		m_systemsPtr->get<AnimationSystem>()->removeAllComponents();
+		m_systemsPtr->get<AnimationSystem>()->setEntities(nullptr);
+		m_systemsPtr->get<DJBoothSystem>()->removeAllComponents();
+	}
+	m_worldPtr->deleteWorld();
+
+	//Free every entity of the match and their components, the slots get reused by the next one
+	m_commandsPtr->clear();
+	m_entitiesPtr->destroyAll();
+	m_playersPtr->clear();
+	m_platformsPtr->clear();
+	m_booths.clear();
+	m_pickUp = nullptr;
+}
+
+TextureRegion MatchBuilder::texture(const std::string& name)
+{
+#ifndef CYBERPUNCH_HEADLESS
+	if (nullptr != m_resourcesPtr)
+		return m_resourcesPtr->getTexture(name);
+#endif
+	return TextureRegion();
+}
+
+void MatchBuilder::addSounds(AudioComponent& audio, std::initializer_list<const char*> names)
+{
+#ifndef CYBERPUNCH_HEADLESS
+	if (nullptr != m_resourcesPtr)
+	{
+		for (auto name : names)
+			audio.addSound(name, m_resourcesPtr->getSFX(name));
+	}
+#endif
+}
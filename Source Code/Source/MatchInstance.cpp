@@ -0,0 +1,258 @@
+#include "MatchInstance.h"
+#include "AISystem.h"
+#include "AnimationSystem.h"
+#include "AttackSystem.h"
+#include "DJBoothSystem.h"
+#include "OnlineInputComponent.h"
+#include "PhysicsSystem.h"
+#include "PickUpSystem.h"
+#include "PlayerComponent.h"
+#include "PlayerInputComponent.h"
+#include "PlayerPhysicsSystem.h"
+#include "PlayerRespawnSystem.h"
+#include "Profiler.h"
+#include <algorithm>
+
+MatchInstance::MatchInstance(const json& level, int bots, uint64_t seed, WorkerPool* workers) :
+	m_commands(&m_entityManager),
+	m_builder(m_entityManager, m_commands, m_physicsWorld, m_collisionListener, m_random, m_events, m_players, m_platforms),
+	m_scheduler(workers),
+	m_playbackPtr(nullptr)
+{
+	std::vector<Replay::Player> players;
+	for (int i = 0; i < bots; i++)
+		players.push_back({ Replay::BOT, i });
+	create(level, players, seed);
+}
+
+MatchInstance::MatchInstance(const json& level, Replay& replay, WorkerPool* workers) :
+	m_commands(&m_entityManager),
+	m_builder(m_entityManager, m_commands, m_physicsWorld, m_collisionListener, m_random, m_events, m_players, m_platforms),
+	m_scheduler(workers),
+	m_playbackPtr(&replay)
+{
+	replay.rewind();
+	create(level, replay.players(), replay.seed());
+}
+
+MatchInstance::~MatchInstance()
+{
+	m_builder.destroy();
+}
+
+/// <summary>
+/// Builds the match with the same builder as the GameScene,
+/// only the systems that change the outcome are added
+/// </summary>
+void MatchInstance::create(const json& level, const std::vector<Replay::Player>& players, uint64_t seed)
+{
+	m_startTimer = START_TIME;
+	m_started = false;
+	m_elapsed = 0;
+	m_steps = 0;
+	m_winner = -1;
+	m_over = false;
+	m_profiled = true;
+	m_slots = players;
+
+	m_random.seed(seed);
+	m_physicsWorld.initWorld();
+	m_physicsWorld.addContactListener(m_collisionListener);
+	m_collisionListener.setListener(&m_events);
+
+	//Only the systems that change the outcome of a match, nothing is drawn or played
+	m_physicsSysPtr = m_systems.add(new PhysicsSystem());
+	m_playerPhysicsSysPtr = m_systems.add(new PlayerPhysicsSystem());
+	m_animationSysPtr = m_systems.add(new AnimationSystem());
+	m_aiSysPtr = m_systems.add(new AISystem());
+	m_attackSysPtr = m_systems.add(new AttackSystem(m_physicsWorld));
+	m_pickUpSysPtr = m_systems.add(new PickUpSystem(nullptr));
+	m_boothSysPtr = m_systems.add(new DJBoothSystem(nullptr, &m_platforms, nullptr, nullptr));
+	m_respawnSysPtr = m_systems.add(new PlayerRespawnSystem());
+	m_playerPhysicsSysPtr->setWorld(m_physicsWorld);
+	m_pickUpSysPtr->setWorld(m_physicsWorld);
+
+	m_builder.create(level, m_slots, m_systems);
+	m_slotPlayers = m_players;
+
+	//Same order as the GameScene without the systems that only draw
+	m_scheduler.add(m_playerPhysicsSysPtr, "PlayerPhysics");
+	m_scheduler.add(m_physicsSysPtr, "Physics");
+	m_scheduler.add(m_attackSysPtr, "Attack");
+	m_scheduler.add(m_pickUpSysPtr, "PickUp");
+	m_scheduler.add(m_boothSysPtr, "DJBooth", false);
+	m_scheduler.add(m_animationSysPtr, "Animation");
+	m_scheduler.add(m_aiSysPtr, "AI");
+	m_scheduler.add(m_respawnSysPtr, "PlayerRespawn");
+}
+
+/// <summary>
+/// What the input system and the GameScene's handleInput do each tick,
+/// with the local and online players' input coming from the replay
+/// </summary>
+void MatchInstance::handleInput()
+{
+	std::string command;
+	OnlineSendComponent::syncStruct sync;
+
+	for (size_t i = 0; i < m_slots.size(); i++)
+	{
+		auto player = m_slotPlayers[i];
+		if (m_slots[i].type == Replay::BOT)
+		{
+			//There's no keyboard or joycon so the bots' buttons read as all up, the AI presses them itself
+			if (nullptr != player)
+			{
+				auto input = player->get<AiInputComponent>();
+				input->m_previous = input->m_current;
+				input->m_current = input->m_default;
+			}
+		}
+		else if (m_slots[i].type == Replay::LOCAL)
+		{
+			Input buttons;
+			if (nullptr != m_playbackPtr)
+				m_playbackPtr->readInput(buttons);
+			if (nullptr != player)
+			{
+				auto input = player->get<PlayerInputComponent>();
+				input->m_previous = input->m_current;
+				for (auto& button : buttons)
+					input->m_current[button.first] = button.second;
+			}
+		}
+		else
+		{
+			auto hasSync = nullptr != m_playbackPtr && m_playbackPtr->readOnline(command, sync);
+			if (nullptr != player)
+			{
+				auto input = player->get<OnlineInputComponent>();
+				if (command.empty() == false)
+					input->addCommand(command);
+				if (hasSync)
+					input->addPositions(sync.pos.x, sync.pos.y, sync.vel.x, sync.vel.y, sync.dvel.x, sync.dvel.y);
+			}
+			command.clear();
+		}
+	}
+	if (nullptr != m_playbackPtr)
+		m_playbackPtr->endReadTick();
+
+	if (m_started == false)
+		return;
+
+	for (auto player : m_players)
+		player->get<ControlComponent>()->handleInput(player);
+}
+
+void MatchInstance::setProfiled(bool profiled)
+{
+	m_profiled = profiled;
+	m_scheduler.setProfiled(profiled);
+}
+
+void MatchInstance::setTaskPool(b2TaskPool * pool)
+{
+	m_physicsWorld.setTaskPool(pool);
+}
+
+void MatchInstance::update(double dt)
+{
+	if (m_over)
+		return;
+
+	handleInput();
+
+	float scalar = m_boothSysPtr->getScalar();
+	if (m_profiled)
+	{
+		PROFILE_ZONE("Box2D");
+		m_physicsWorld.update(dt * scalar);
+	}
+	else
+		m_physicsWorld.update(dt * scalar);
+	m_scheduler.run(dt, scalar);
+
+	//The countdown before anyone can move
+	if (m_started == false)
+	{
+		m_startTimer -= dt;
+		m_started = m_startTimer <= 0;
+	}
+
+	removeDeadPlayers();
+
+	//Last one standing wins, if the last few go out together nobody does
+	if (m_players.size() <= 1)
+	{
+		if (m_players.size() == 1)
+		{
+			m_players.at(0)->get<PlayerComponent>()->isWinner() = true;
+			m_winner = m_players.at(0)->get<PlayerComponent>()->m_playerIndex;
+		}
+		m_over = true;
+	}
+
+	m_commands.flush();
+	m_elapsed += dt;
+	m_steps++;
+}
+
+/// <summary>
+/// FNV-1a over the bodies in the order Box2D keeps them, which is the order they were made,
+/// then over the players still in the match by their slot
+/// </summary>
+uint64_t MatchInstance::stateHash()
+{
+	uint64_t hash = 14695981039346656037ULL;
+	auto add = [&hash](const void* data, size_t size)
+	{
+		auto bytes = static_cast<const uint8_t*>(data);
+		for (size_t i = 0; i < size; i++)
+		{
+			hash ^= bytes[i];
+			hash *= 1099511628211ULL;
+		}
+	};
+
+	for (auto body = m_physicsWorld.getWorld().GetBodyList(); nullptr != body; body = body->GetNext())
+	{
+		auto& position = body->GetPosition();
+		auto& velocity = body->GetLinearVelocity();
+		auto angle = body->GetAngle();
+		add(&position, sizeof(position));
+		add(&velocity, sizeof(velocity));
+		add(&angle, sizeof(angle));
+	}
+
+	for (size_t i = 0; i < m_slotPlayers.size(); i++)
+	{
+		if (nullptr == m_slotPlayers[i])
+			continue;
+		auto player = m_slotPlayers[i]->get<PlayerComponent>();
+		add(&i, sizeof(i));
+		add(&player->getLives(), sizeof(int));
+		add(&player->m_dmgTaken, sizeof(player->m_dmgTaken));
+	}
+	return hash;
+}
+
+/// <summary>
+/// Takes players that are out of lives out of the match,
+/// the same as the GameScene does
+/// </summary>
+void MatchInstance::removeDeadPlayers()
+{
+	std::vector<Entity*> dead;
+	for (auto player : m_players)
+	{
+		if (player->get<PlayerComponent>()->isDead())
+			dead.push_back(player);
+	}
+
+	for (auto player : dead)
+	{
+		m_builder.removePlayer(player);
+		std::replace(m_slotPlayers.begin(), m_slotPlayers.end(), player, (Entity*)nullptr);
+	}
+}
@@ -0,0 +1,51 @@
+#include "MatchRunner.h"
+
+MatchRunner::MatchRunner(unsigned int threads) :
+	m_workers(threads)
+{
+}
+
+void MatchRunner::add(MatchInstance * match)
+{
+	match->setProfiled(false);
+	m_matches.emplace_back(match);
+}
+
+/// <summary>
+/// Steps the matches side by side, one job per match
+/// </summary>
+/// <param name="dt">Time to step each match by</param>
+void MatchRunner::step(double dt)
+{
+	for (auto& match : m_matches)
+	{
+		if (match->isOver())
+			continue;
+
+		auto matchPtr = match.get();
+		m_workers.push([matchPtr, dt]() { matchPtr->update(dt); });
+	}
+
+	m_workers.wait();
+}
+
+/// <summary>
+/// Plays every match out, each one is a single job
+/// so a thread keeps the same match until it is done
+/// </summary>
+/// <param name="dt">Time to step the matches by</param>
+/// <param name="maxSeconds">Match time a match is stopped at if nobody has won</param>
+void MatchRunner::run(double dt, double maxSeconds)
+{
+	for (auto& match : m_matches)
+	{
+		auto matchPtr = match.get();
+		m_workers.push([matchPtr, dt, maxSeconds]()
+		{
+			while (matchPtr->isOver() == false && matchPtr->elapsed() < maxSeconds)
+				matchPtr->update(dt);
+		});
+	}
+
+	m_workers.wait();
+}
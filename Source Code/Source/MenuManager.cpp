@@ -7,12 +7,14 @@ MenuManager::MenuManager() :
 	{
 		printf("TTF_Init: %s\n", TTF_GetError());
 	}
+	auto preGame = new PreGameScene();
+	auto achievements = new AchievementsScene();
 	m_scenes["Main Menu"] = new MainMenuScene();
 	m_scenes["Options"] = new OptionsScene();
-	m_scenes["Game"] = new GameScene();
+	m_scenes["Game"] = new GameScene(preGame->playerIndexes(), achievements->achievements()); //The match is set up from the pre game picks
 	m_scenes["Multiplayer"] = new LobbyScene();
-	m_scenes["PreGame"] = new PreGameScene();
-	m_scenes["Achievements"] = new AchievementsScene();
+	m_scenes["PreGame"] = preGame;
+	m_scenes["Achievements"] = achievements;
 }
 
 void MenuManager::update(double dt)
@@ -59,7 +61,7 @@ void MenuManager::setResourceHandler(ResourceHandler & resources)
 	}
 }
 
-void MenuManager::setSystemPtr(std::map<std::string, System*>& systems)
+void MenuManager::setSystemPtr(SystemRegistry& systems)
 {
 	for (auto& scene : m_scenes)
 	{
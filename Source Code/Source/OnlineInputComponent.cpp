@@ -1,15 +1,15 @@
 #include "OnlineInputComponent.h"
 
-OnlineInputComponent::OnlineInputComponent()
+OnlineInputComponent::OnlineInputComponent() :
+	m_currentCMD(nullptr),
+	m_previousCMD(nullptr)
 {
 	m_commandsToSend = queue<string>();
 }
 
 
-void OnlineInputComponent::handleInput(void* e)
+void OnlineInputComponent::handleInput(Entity* entity)
 {
-	auto entity = static_cast<Entity*>(e);
-
 	if (m_positionsToSyncTo.size() > 0)
 	{
 		OnlineSendComponent::syncStruct loc = m_positionsToSyncTo.front();
@@ -60,7 +60,7 @@ void OnlineInputComponent::handleInput(void* e)
 		else if (topCMD == "RESPAWN")
 		{
 			//m_currentCMD = &m_superCMD;
-			static_cast<PlayerComponent*>(&entity->getComponent("Player"))->respawn();
+			entity->get<PlayerComponent>()->respawn();
 		}
 		m_commandsToSend.pop();
 		//If the current command was set, execute the command
@@ -69,12 +69,12 @@ void OnlineInputComponent::handleInput(void* e)
 			m_currentCMD->execute(*entity);
 		}
 	}
-	else if (static_cast<AttackComponent*>(&entity->getComponent("Attack"))->attackActive() == false
-		&& !(static_cast<AnimationComponent*>(&entity->getComponent("Animation"))->getCurrentID() == "Jump"
-			&& static_cast<AnimationComponent*>(&entity->getComponent("Animation"))->getCurrentAnimation()->getCompleted() == false)
-		&& static_cast<PlayerPhysicsComponent*>(&entity->getComponent("Player Physics"))->stunned() == false)
+	else if (entity->get<AttackComponent>()->attackActive() == false
+		&& !(entity->get<AnimationComponent>()->getCurrentID() == "Jump"
+			&& entity->get<AnimationComponent>()->getCurrentAnimation()->getCompleted() == false)
+		&& entity->get<PlayerPhysicsComponent>()->stunned() == false)
 	{
-		//static_cast<AnimationComponent*>(&entity->getComponent("Animation"))->playAnimation("Idle", true);
+		//entity->get<AnimationComponent>()->playAnimation("Idle", true);
 		m_idleCMD.execute(*entity);
 	}
 
@@ -102,15 +102,14 @@ void OnlineInputComponent::addPositions(float px, float py, float vx, float vy,
 
 void OnlineInputComponent::syncPosition(Entity* entity, float px, float py, float vx, float vy, float dvx, float dvy)
 {
-	//std::cout << static_cast<PlayerPhysicsComponent*>(&entity->getComponent("Player Physics"))->canJump() << std::endl;
+	//std::cout << entity->get<PlayerPhysicsComponent>()->canJump() << std::endl;
 	//auto entity = static_cast<Entity*>(e);
-	Vector2f asdf = static_cast<PlayerPhysicsComponent*>(&entity->getComponent("Player Physics"))->m_body->getPosition();
-	static_cast<PlayerPhysicsComponent*>(&entity->getComponent("Player Physics"))->m_body->setPosition(px, py+25);
-	//static_cast<PlayerPhysicsComponent*>(&entity->getComponent("Player Physics"))->posPtr->position = Vector2f(px, py);
-	//static_cast<PlayerPhysicsComponent*>(&entity->getComponent("Player Physics"))->m_currentVel = b2Vec2(vx, vy);
-	//static_cast<PlayerPhysicsComponent*>(&entity->getComponent("Player Physics"))->m_desiredVel = b2Vec2(dvx, dvy);
-	static_cast<PlayerPhysicsComponent*>(&entity->getComponent("Player Physics"))->m_jumpSensor->setPosition(px, py+25);
-	//std::cout<<static_cast<PlayerPhysicsComponent*>(&entity->getComponent("Player Physics"))->canJump()<<std::endl;
+	Vector2f asdf = entity->get<PlayerPhysicsComponent>()->m_body->getPosition();
+	entity->get<PlayerPhysicsComponent>()->m_body->setPosition(px, py+25);
+	//entity->get<PlayerPhysicsComponent>()->posPtr->position = Vector2f(px, py);
+	//entity->get<PlayerPhysicsComponent>()->m_currentVel = b2Vec2(vx, vy);
+	//entity->get<PlayerPhysicsComponent>()->m_desiredVel = b2Vec2(dvx, dvy);
+	//std::cout<<entity->get<PlayerPhysicsComponent>()->canJump()<<std::endl;
 }
 
 
@@ -1,8 +1,9 @@
 #include "OnlineSystem.h"
+#include <algorithm>
 
 void OnlineSystem::addComponent(Component * component)
 {
-	m_components.push_back(component);
+	insertComponent(component);
 }
 
 void OnlineSystem::addSendingPlayer(OnlineSendComponent * component)
@@ -15,6 +16,27 @@ void OnlineSystem::addReceivingPlayer(OnlineInputComponent * component)
 	m_receivingPlayers.push_back(component);
 }
 
+void OnlineSystem::removeSendingPlayer(OnlineSendComponent * component)
+{
+	m_sendingPlayers.erase(std::remove(m_sendingPlayers.begin(), m_sendingPlayers.end(), component), m_sendingPlayers.end());
+}
+
+void OnlineSystem::removeReceivingPlayer(OnlineInputComponent * component)
+{
+	m_receivingPlayers.erase(std::remove(m_receivingPlayers.begin(), m_receivingPlayers.end(), component), m_receivingPlayers.end());
+}
+
+/// <summary>
+/// Empties the system and forgets the players,
+/// their components go with the match that made them
+/// </summary>
+void OnlineSystem::removeAllComponents()
+{
+	System::removeAllComponents();
+	m_sendingPlayers.clear();
+	m_receivingPlayers.clear();
+}
+
 void OnlineSystem::update(double dt)
 {
 	if (isConnected)
@@ -74,8 +96,8 @@ void OnlineSystem::SendCommands(bool sync)
 
 void OnlineSystem::ReceiveCommands()
 {
-	// Check if we've received a message
-	string receivedMessage = m_Socket->checkForIncomingMessages();
+	// Check if we've received a message, without waiting as this runs every step and the frame pacer does the waiting
+	string receivedMessage = m_Socket->checkForIncomingMessages(0);
 
 	 //If so then...
 	if (receivedMessage == "Lost connection to the server!")
@@ -27,7 +27,7 @@ void OptionsScene::start()
 	auto sprite = new SpriteComponent(pos, Vector2f(1920, 1080), Vector2f(1920, 1080), Scene::resources().getTexture("Credits"), 0);
 	m_txtImage->addComponent("Sprite", sprite);
 
-	Scene::systems()["Render"]->addComponent(&m_txtImage->getComponent("Sprite"));
+	Scene::systems().get<RenderSystem>()->addComponent(&m_txtImage->getComponent("Sprite"));
 }
 
 /// <summary>
@@ -35,7 +35,7 @@ void OptionsScene::start()
 /// </summary>
 void OptionsScene::stop()
 {
-	Scene::systems()["Render"]->deleteComponent(&m_txtImage->getComponent("Sprite"));
+	Scene::systems().get<RenderSystem>()->deleteComponent(&m_txtImage->getComponent("Sprite"));
 	delete(&m_txtImage->getComponent("Pos"));
 	delete(&m_txtImage->getComponent("Sprite"));
 }
@@ -55,7 +55,7 @@ void OptionsScene::update(double dt)
 /// <param name="renderer"></param>
 void OptionsScene::draw(SDL_Renderer & renderer)
 {
-	static_cast<RenderSystem *>(Scene::systems()["Render"])->render(renderer, m_camera);
+	Scene::systems().get<RenderSystem>()->render(renderer, m_camera);
 }
 
 /// <summary>
@@ -64,7 +64,7 @@ void OptionsScene::draw(SDL_Renderer & renderer)
 /// <param name="input"></param>
 void OptionsScene::handleInput(InputSystem& input)
 {
-	Scene::systems()["Input"]->update(0);
+	Scene::systems().get<InputSystem>()->update(0);
 	m_input = static_cast<InputComponent *>(input.m_components.at(0));
 
 	if (m_input->m_current["ABTN"])
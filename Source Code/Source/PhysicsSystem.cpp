@@ -3,19 +3,25 @@
 void PhysicsSystem::addComponent(Component * comp)
 {
 	//Add component to the system
-	m_components.push_back(comp);
+	insertComponent(comp);
 }
 
 void PhysicsSystem::update(double dt)
 {
+	if (nullptr == m_entitiesPtr)
+		return;
+
 	//Loop through all of the physics components and set the position components based on their physics position
-	for (auto& comp : m_components)
+	auto& positions = m_entitiesPtr->components<PositionComponent>();
+	for (auto p : m_items)
 	{
-		//Convert the component to a physics component
-		auto p = dynamic_cast<PhysicsComponent*>(comp);
+		if (nullptr == p->ownerPtr)
+			continue;
 
-		//Assign the bodies position the position component
-		p->posPtr->position = p->m_body->getPosition();
+		//Assign the bodies position the position component, keeping the old one so the draw can blend between them
+		auto pos = positions.get(p->ownerPtr->handle());
+		if (nullptr != pos)
+			pos->step(p->m_body->getPosition());
 	}
 }
 
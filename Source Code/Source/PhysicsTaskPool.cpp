@@ -0,0 +1,27 @@
+#include "PhysicsTaskPool.h"
+
+PhysicsTaskPool::PhysicsTaskPool(WorkerPool & workers) :
+	m_workers(workers)
+{
+}
+
+int32 PhysicsTaskPool::GetWorkerCount() const
+{
+	return m_workers.size() + 1;
+}
+
+/// <summary>
+/// Hands every task but the first to the workers, runs the first here and waits for the rest.
+/// Only this step's tasks are waited on, worlds stepped side by side can share the workers
+/// </summary>
+/// <param name="task">The islands to solve</param>
+/// <param name="count">How many tasks the islands were split into</param>
+void PhysicsTaskPool::Run(b2Task * task, int32 count)
+{
+	WorkerPool::Group group;
+	for (int32 i = 1; i < count; i++)
+		m_workers.push([task, i]() { task->Execute(i); }, group);
+
+	task->Execute(0);
+	m_workers.wait(group);
+}
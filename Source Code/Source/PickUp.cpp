@@ -3,7 +3,7 @@
 PickUp::PickUp() :
 	m_moveSpeed(5),
 	m_posComonponent(800,800),
-	m_physComponent(&m_posComonponent),
+	m_physComponent(nullptr),
 	m_draw(true)
 {
 
@@ -17,7 +17,7 @@ void PickUp::createPickUp(Box2DBridge& world, PhysicsSystem& system)
 
 		m_worldPtr = &world;
 		physPtr = &system;
-		m_physComponent = PhysicsComponent(&m_posComonponent);
+		m_physComponent = PhysicsComponent(nullptr);
 
 		m_physComponent.m_body = world.createBox(950, 400, 40, 40, false, false, b2BodyType::b2_dynamicBody);
 		world.addProperties(*m_physComponent.m_body, 1, 0.1f, 0.0f, true, new PhysicsComponent::ColData("Pick-Up", this));
@@ -1,13 +1,18 @@
-#include "..\Header\PickUpComponent.h"
+#include "PickUpComponent.h"
 
-PickUpComponent::PickUpComponent(Entity* pickupEntity) :
+PickUpComponent::PickUpComponent(Entity* pickupEntity, Random& random) :
 	m_pickupEntity(pickupEntity),
 	m_timeLive(10),
 	m_timeTillSpawn(10),
 	m_timeInBooth(10),
 	m_spawned(false),
 	m_currentPos(0),
-	m_body(nullptr)
+	m_end(false),
+	m_body(nullptr),
+	m_random(random),
+	m_playerToTele(nullptr),
+	m_teleport(false),
+	m_back(false)
 {
 }
 
@@ -16,8 +21,9 @@ void PickUpComponent::spawn(Box2DBridge & world)
 	m_end = false;
 	m_spawned = true;
 	m_timeLive = 10; //10 seconds
+	//The last body went back to the world when it despawned
 	delete m_body;
-	m_body = new PhysicsComponent(new PositionComponent(0,0));
+	m_body = new PhysicsComponent(nullptr);
 
 	if (m_currentPos == 1)
 	{
@@ -39,12 +45,12 @@ void PickUpComponent::spawn(Box2DBridge & world)
 		m_position = m_pos5;
 		//m_teleportLocationB = m_position;
 	}
-	m_currentPos = rand() % 5 + 1;
+	m_currentPos = m_random.range(5) + 1;
 	//creates a box2d body for the pickup and defines it proporties
 	m_body->m_body = world.createBox(m_position.x, m_position.y, 50, 50, false, false, b2BodyType::b2_staticBody);
 	world.addProperties(*m_body->m_body, 0, 0, 0, true, new PhysicsComponent::ColData("Pickup", m_pickupEntity));
 	
-	static_cast<PositionComponent*>(&m_pickupEntity->getComponent("Pos"))->position = Vector2f(m_position);
+	m_pickupEntity->get<PositionComponent>()->position = Vector2f(m_position);
 }
 
 void PickUpComponent::despawn(Box2DBridge & world)
@@ -52,7 +58,7 @@ void PickUpComponent::despawn(Box2DBridge & world)
 	//despawns the record after its been spawned for 10 seconds
 	m_timeTillSpawn = 10; //10 seconds
 	m_spawned = false;
-	m_currentPos = rand() % 5 + 1;
+	m_currentPos = m_random.range(5) + 1;
 
 	world.deleteBody(m_body->m_body);
 }
\ No newline at end of file
@@ -1,6 +1,6 @@
 #include "PickUpSystem.h"
 #include "PlayerPhysicsComponent.h"
-#include "RenderSystem.h"
+#include "SpriteComponent.h"
 
 void PickUpSystem::setWorld(Box2DBridge & world)
 {
@@ -9,7 +9,7 @@ void PickUpSystem::setWorld(Box2DBridge & world)
 
 void PickUpSystem::addComponent(Component * comp)
 {
-	m_components.push_back(comp);
+	insertComponent(comp);
 }
 
 void PickUpSystem::update(double dt)
@@ -18,7 +18,8 @@ void PickUpSystem::update(double dt)
 	for (auto& comp : m_components)
 	{
 		auto pickup = static_cast<PickUpComponent*>(comp);
-		if (!m_netSysPtr->isConnected || m_netSysPtr->m_isHost)
+		auto online = nullptr != m_netSysPtr && m_netSysPtr->isConnected;
+		if (!online || m_netSysPtr->m_isHost)
 		{
 			if (pickup->getTimeTillSpawn() > 0)
 			{
@@ -27,13 +28,16 @@ void PickUpSystem::update(double dt)
 				if (pickup->getTimeTillSpawn() <= 0)
 				{
 					pickup->spawn(*m_worldPtr);
-					m_renderSysPtr->addComponent(&pickup->getPickupEntity()->getComponent("Sprite"));
-					if (m_netSysPtr->isConnected)
+					pickup->getPickupEntity()->get<SpriteComponent>()->isVisible() = true;
+#ifndef CYBERPUNCH_HEADLESS
+					if (online)
 						m_netSysPtr->spawnPickup(pickup->m_currentPos);
+#endif
 				}
 
 			}
 		}
+#ifndef CYBERPUNCH_HEADLESS
 		else 
 		{
 			int loc = m_netSysPtr->pickupLocation();
@@ -41,9 +45,10 @@ void PickUpSystem::update(double dt)
 			{
 				pickup->m_currentPos = loc; 
 				pickup->spawn(*m_worldPtr);
-				m_renderSysPtr->addComponent(&pickup->getPickupEntity()->getComponent("Sprite"));
+				pickup->getPickupEntity()->get<SpriteComponent>()->isVisible() = true;
 			}
 		}
+#endif
 
 		//countdown for time in booths
 		if (pickup->toTeleportB())
@@ -54,11 +59,10 @@ void PickUpSystem::update(double dt)
 			//sets timer back to 10 seconds and moves player back into the game
 			if (pickup->getTimeInBooth() <= 0 || pickup->m_end)
 			{
-				auto p = static_cast<PlayerPhysicsComponent*>(&pickup->getPlayer()->getComponent("Player Physics"));
+				auto p = pickup->getPlayer()->get<PlayerPhysicsComponent>();
 				pickup->toTeleport() = false;
 				pickup->toTeleportB() = false;
 				p->m_body->setPosition(pickup->getTeleportLocationB().x, pickup->getTeleportLocationB().y);
-				p->m_jumpSensor->setPosition(pickup->getTeleportLocationB().x, pickup->getTeleportLocationB().y);
 				pickup->getTimeInBooth() = 10;
 			}
 
@@ -71,13 +75,12 @@ void PickUpSystem::update(double dt)
 			if (pickup->toTeleport())
 			{
 				// sends player to booth, despawns the pickup and sets the timer to countdown
-				auto p = static_cast<PlayerPhysicsComponent*>(&pickup->getPlayer()->getComponent("Player Physics"));
+				auto p = pickup->getPlayer()->get<PlayerPhysicsComponent>();
 				pickup->getTeleportLocationB() = p->m_body->getPosition();
 				auto teleLoc = pickup->getTeleportLocation();
 				p->m_body->setPosition(teleLoc.x, teleLoc.y);
-				p->m_jumpSensor->setPosition(teleLoc.x, teleLoc.y);
 				pickup->despawn(*m_worldPtr);
-				m_renderSysPtr->deleteComponent(&pickup->getPickupEntity()->getComponent("Sprite"));
+				pickup->getPickupEntity()->get<SpriteComponent>()->isVisible() = false;
 				pickup->toTeleportB() = true;
 				pickup->getTimeInBooth() = 10;
 			}
@@ -90,7 +93,7 @@ void PickUpSystem::update(double dt)
 				if (pickup->getTimeLive() <= 0)
 				{
 					pickup->despawn(*m_worldPtr);
-					m_renderSysPtr->deleteComponent(&pickup->getPickupEntity()->getComponent("Sprite"));
+					pickup->getPickupEntity()->get<SpriteComponent>()->isVisible() = false;
 				}
 			}
 
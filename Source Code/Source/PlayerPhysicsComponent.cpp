@@ -1,8 +1,12 @@
 #include "PlayerPhysicsComponent.h"
+#include "PhysicsComponent.h"
 
-PlayerPhysicsComponent::PlayerPhysicsComponent(Component * pos) :
+PlayerPhysicsComponent::PlayerPhysicsComponent(Entity * owner) :
 	m_body(nullptr),
 	m_jumpSensor(nullptr),
+	ownerPtr(owner),
+	m_currentVel(0, 0),
+	m_desiredVel(0, 0),
 	m_stunned(false),
 	m_canFall(false),
 	m_canJump(false),
@@ -15,14 +19,14 @@ PlayerPhysicsComponent::PlayerPhysicsComponent(Component * pos) :
 	m_setStatic(false),
 	m_setDynamic(false),
 	m_stunLeft(0),
-	m_jumpSpeed(40.0f),
-	m_jumpDownSpeed(20.0f),
+	m_superTime(0),
+	m_jumpSpeed(22.0f),
+	m_jumpDownSpeed(11.0f),
 	m_moveSpeed(10),
 	m_dmgPercentage(0),
 	m_originalMass(0),
 	m_superPercentage(0)
 {
-	posPtr = static_cast<PositionComponent*>(pos);
 }
 
 void PlayerPhysicsComponent::stun()
@@ -130,21 +134,40 @@ void PlayerPhysicsComponent::applyDamageImpulse(float x, float y)
 void PlayerPhysicsComponent::flipGravity(Box2DBridge& world)
 {
 	m_gravFlipped = !m_gravFlipped;
-	m_sensorJointDef.localAnchorA.Set(m_sensorJoint->GetLocalAnchorA().x, -m_sensorJoint->GetLocalAnchorA().y);
-	world.getWorld().DestroyJoint(m_sensorJoint);
-	world.getWorld().CreateJoint(&m_sensorJointDef);
+
+	//Destroying a fixture works the mass out again from the fixtures, keep what the body has now
+	b2MassData mass;
+	m_body->getBody()->GetMassData(&mass);
+
+	//Move the sensor to the other side of the body, the same data goes with it
+	auto data = m_jumpSensor->GetUserData();
+	m_body->getBody()->DestroyFixture(m_jumpSensor);
+	createJumpSensor(world, data);
+
+	m_body->getBody()->SetMassData(&mass);
 }
 
-void PlayerPhysicsComponent::createJoint(Box2DBridge & world)
+void PlayerPhysicsComponent::createBody(Box2DBridge & world, int posX, int posY, void* player)
 {
-	//Define the sensor
-	m_sensorJointDef.bodyA = m_body->getBody();
-	m_sensorJointDef.bodyB = m_jumpSensor->getBody();
-	m_sensorJointDef.collideConnected = false;
-	m_sensorJointDef.localAnchorA.Set(0, 1.35f);
+	m_body = world.createBox(posX, posY, 30, 78, false, false, b2BodyType::b2_dynamicBody);
+	world.addProperties(*m_body, 1, 0.05f, 0.0f, false, new PhysicsComponent::ColData("Player Body", player));
+
+	//Set the gravity scale, this makes the player less floaty
+	m_body->getBody()->SetGravityScale(1.7f);
 
-	//Create the joints
-	m_sensorJoint = (b2RevoluteJoint*)world.getWorld().CreateJoint(&m_sensorJointDef);
+	//Players weigh what they did when the jump sensor was its own body, so knockback is the same
+	b2MassData mass;
+	m_body->getBody()->GetMassData(&mass);
+	mass.mass = 2;
+	m_body->getBody()->SetMassData(&mass);
+
+	createJumpSensor(world, new PhysicsComponent::ColData("Jump Sensor", player));
+}
+
+void PlayerPhysicsComponent::createJumpSensor(Box2DBridge & world, void* data)
+{
+	//The sensor sits just past the players feet, or their head when gravity is flipped
+	m_jumpSensor = world.addSensor(*m_body, 0, m_gravFlipped ? -40.5f : 40.5f, 27, 5, data);
 }
 
 float PlayerPhysicsComponent::clamp(float min, float & val, float max)
@@ -157,7 +180,7 @@ float PlayerPhysicsComponent::clamp(float min, float & val, float max)
 
 void PlayerPhysicsComponent::move(int direction)
 {
-	m_currentVel.x += 0.4f * direction;
+	m_currentVel.x += 0.2f * direction;
 
 	m_currentVel.x = clamp(-m_moveSpeed, m_currentVel.x, m_moveSpeed);
 }
@@ -7,11 +7,12 @@ void PlayerPhysicsSystem::setWorld(Box2DBridge & world)
 
 void PlayerPhysicsSystem::addComponent(Component * comp)
 {
-	m_components.push_back(comp);
+	insertComponent(comp);
 }
 
 void PlayerPhysicsSystem::update(double dt)
 {
+	auto positions = nullptr != m_entitiesPtr ? &m_entitiesPtr->components<PositionComponent>() : nullptr;
 	for (auto& comp : m_components)
 	{
 		//Convert the component down to a player physics component
@@ -76,7 +77,9 @@ void PlayerPhysicsSystem::update(double dt)
 		}
 
 		//set the position component of the player
-		p->posPtr->position = p->m_body->getPosition();
+		auto pos = nullptr != positions ? positions->get(p->ownerPtr->handle()) : nullptr;
+		if (nullptr != pos)
+			pos->step(p->m_body->getPosition());
 	}
 
 	if (m_gravityChange)
@@ -7,7 +7,7 @@ PlayerRespawnSystem::PlayerRespawnSystem()
 
 void PlayerRespawnSystem::addComponent(Component * c)
 {
-	m_components.push_back(c);
+	insertComponent(c);
 }
 
 void PlayerRespawnSystem::update(double dt)
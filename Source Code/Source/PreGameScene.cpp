@@ -1,8 +1,7 @@
-#include "..\Header\PreGameScene.h"
+#include "PreGameScene.h"
 #include "RenderSystem.h"
 
 
-PreGameScene::PlayersInfo PreGameScene::playerIndexes;
 PreGameScene::PreGameScene() :
 	m_bg("BG"),
 	m_camera(false),
@@ -18,9 +17,9 @@ void PreGameScene::start()
 {
 	for (auto b : m_availablePlyrs)
 		b = true;
-	playerIndexes.localPlyrs.clear();
-	playerIndexes.onlinePlyrs.clear();
-	playerIndexes.botPlyrs.clear();
+	m_playerIndexes.localPlyrs.clear();
+	m_playerIndexes.onlinePlyrs.clear();
+	m_playerIndexes.botPlyrs.clear();
 
 	m_input.clear();
 
@@ -33,11 +32,11 @@ void PreGameScene::start()
 		m_bg.addComponent("Sprite", new SpriteComponent(bgPos, Vector2f(1920, 1080), Vector2f(1920, 1080), Scene::resources().getTexture("Pre Game BG"), 0));
 	}
 
-	Scene::systems()["Render"]->addComponent(&m_bg.getComponent("Sprite"));
+	Scene::systems().get<RenderSystem>()->addComponent(&m_bg.getComponent("Sprite"));
 
-	m_network = static_cast<OnlineSystem*>(Scene::systems()["Network"]);
+	m_network = Scene::systems().get<OnlineSystem>();
 
-	m_input.push_back(pair<InputComponent*,int>(static_cast<InputComponent*>(Scene::systems()["Input"]->m_components.at(0)), -1));
+	m_input.push_back(pair<InputComponent*,int>(static_cast<InputComponent*>(Scene::systems().get<InputSystem>()->m_components.at(0)), -1));
 	//m_input[0].first.initialiseJoycon(0);
 	//m_hasJoined.push_back(true);
 
@@ -47,13 +46,13 @@ void PreGameScene::start()
 		if (m_network->m_isHost)
 		{
 			//m_input[0] gets to be player 1
-			playerIndexes.localPlyrs.push_back(pair<int,int>(0,0));
+			m_playerIndexes.localPlyrs.push_back(pair<int,int>(0,0));
 			m_availablePlyrs[0] = false;
 			m_input[0].second = 0;
 		}
 		else {
 			//m_input[0] becomes the first available player
-			playerIndexes.localPlyrs.push_back(pair<int, int>(0,m_network->m_playerNumber));//move from member var to getter
+			m_playerIndexes.localPlyrs.push_back(pair<int, int>(0,m_network->m_playerNumber));//move from member var to getter
 			m_availablePlyrs[m_network->m_playerNumber] = false;
 			m_input[0].second = m_network->m_playerNumber;
 		}
@@ -61,18 +60,18 @@ void PreGameScene::start()
 
 		for (auto num : players)
 		{
-			if (num != playerIndexes.localPlyrs.back().second)
+			if (num != m_playerIndexes.localPlyrs.back().second)
 			{
-				playerIndexes.onlinePlyrs.push_back(num);
+				m_playerIndexes.onlinePlyrs.push_back(num);
 				m_availablePlyrs[num] = false;
 
-				//playerIndexes.botPlyrs.push_back(num);
+				//m_playerIndexes.botPlyrs.push_back(num);
 			}
 		}
 
 	}
 	else {
-		playerIndexes.localPlyrs.push_back(pair<int, int>(0,0));
+		m_playerIndexes.localPlyrs.push_back(pair<int, int>(0,0));
 		m_availablePlyrs[0] = false;
 		m_input[0].second = 0;
 	}
@@ -81,7 +80,7 @@ void PreGameScene::start()
 	{
 		m_input.push_back(pair<InputComponent*,int>(new InputComponent(), -1));
 		m_input[i].first->initialiseJoycon(i);
-		Scene::systems()["Input"]->addComponent(m_input[i].first);
+		Scene::systems().get<InputSystem>()->addComponent(m_input[i].first);
 		//m_hasJoined.push_back(false);
 	}
 
@@ -93,12 +92,12 @@ void PreGameScene::start()
 
 void PreGameScene::stop()
 {
-	Scene::systems()["Render"]->deleteComponent(&m_bg.getComponent("Sprite"));
+	Scene::systems().get<RenderSystem>()->deleteComponent(&m_bg.getComponent("Sprite"));
 
 	for (auto& badge : m_playerIcons)
 	{
-		Scene::systems()["Render"]->deleteComponent(&badge->getComponent("Sprite"));
-		Scene::systems()["Render"]->deleteComponent(&badge->getComponent("Ind Sprite"));
+		Scene::systems().get<RenderSystem>()->deleteComponent(&badge->getComponent("Sprite"));
+		Scene::systems().get<RenderSystem>()->deleteComponent(&badge->getComponent("Ind Sprite"));
 
 		delete &badge->getComponent("Pos");
 		delete &badge->getComponent("Ind Pos");
@@ -131,13 +130,13 @@ void PreGameScene::update(double dt)
 
 void PreGameScene::draw(SDL_Renderer & renderer)
 {
-	static_cast<RenderSystem*>(Scene::systems()["Render"])->render(renderer, m_camera);
+	Scene::systems().get<RenderSystem>()->render(renderer, m_camera);
 }
 
 void PreGameScene::handleInput(InputSystem & input)
 {
 	//Update the input system
-	Scene::systems()["Input"]->update(0);
+	Scene::systems().get<InputSystem>()->update(0);
 	bool playersChanged = false;
 
 	//If the main menu input component is not added to the system, add it
@@ -165,15 +164,15 @@ void PreGameScene::handleInput(InputSystem & input)
 			//tell network you are leaving. It's only polite
 			//you'll have to tell it to shut down the lobby too probs....
 			if (m_network->isConnected) {
-				//vector<int> p = playerIndexes.localPlyrs;
-				//p.insert(p.end(), playerIndexes.onlinePlyrs.begin(), playerIndexes.onlinePlyrs.end());
+				//vector<int> p = m_playerIndexes.localPlyrs;
+				//p.insert(p.end(), m_playerIndexes.onlinePlyrs.begin(), m_playerIndexes.onlinePlyrs.end());
 				vector<int> p{ 0,1,2,3 };
 				m_network->disconnect(p);
 				m_network->m_isHost = false;
 			}
-			playerIndexes.localPlyrs.clear();
-			playerIndexes.onlinePlyrs.clear();
-			playerIndexes.botPlyrs.clear();
+			m_playerIndexes.localPlyrs.clear();
+			m_playerIndexes.onlinePlyrs.clear();
+			m_playerIndexes.botPlyrs.clear();
 			Scene::goToScene("Main Menu");
 		}
 		else if (m_input[0].first->isButtonPressed("BBTN"))
@@ -187,7 +186,7 @@ void PreGameScene::handleInput(InputSystem & input)
 					if (m_availablePlyrs[j])
 					{
 						m_availablePlyrs[j] = false;
-						playerIndexes.botPlyrs.push_back(j);
+						m_playerIndexes.botPlyrs.push_back(j);
 						m_playerIcons.push_back(createBadge(240 + m_playerIcons.size() * 480, 540, false, j));
 						playersChanged = true;
 						break;
@@ -202,11 +201,11 @@ void PreGameScene::handleInput(InputSystem & input)
 				//remove AI
 				for (int j = m_availablePlyrs.size(); j > 0; j--)
 				{
-					if (std::find(playerIndexes.botPlyrs.begin(), playerIndexes.botPlyrs.end(), j) != playerIndexes.botPlyrs.end() && !m_availablePlyrs[j])
+					if (std::find(m_playerIndexes.botPlyrs.begin(), m_playerIndexes.botPlyrs.end(), j) != m_playerIndexes.botPlyrs.end() && !m_availablePlyrs[j])
 					{
 						m_availablePlyrs[j] = true;
-						playerIndexes.botPlyrs.push_back(j);
-						playerIndexes.botPlyrs.erase(std::remove(playerIndexes.botPlyrs.begin(), playerIndexes.botPlyrs.end(), j), playerIndexes.botPlyrs.end());
+						m_playerIndexes.botPlyrs.push_back(j);
+						m_playerIndexes.botPlyrs.erase(std::remove(m_playerIndexes.botPlyrs.begin(), m_playerIndexes.botPlyrs.end(), j), m_playerIndexes.botPlyrs.end());
 						playersChanged = true;
 						break;
 					}
@@ -228,7 +227,7 @@ void PreGameScene::handleInput(InputSystem & input)
 						if (m_availablePlyrs[j])
 						{
 							m_availablePlyrs[j] = false;
-							playerIndexes.localPlyrs.push_back(pair<int, int>(i,j));
+							m_playerIndexes.localPlyrs.push_back(pair<int, int>(i,j));
 							m_input[i].second = j;
 							//tell the network you've joined
 							playersChanged = true;
@@ -243,7 +242,7 @@ void PreGameScene::handleInput(InputSystem & input)
 				if (m_input[i].second > 0)//controllers not joined are set to -1
 				{
 					m_availablePlyrs[m_input[i].second] = true;
-					playerIndexes.localPlyrs.erase(std::remove(playerIndexes.localPlyrs.begin(), playerIndexes.localPlyrs.end(), pair<int,int>(i,m_input[i].second)), playerIndexes.localPlyrs.end());
+					m_playerIndexes.localPlyrs.erase(std::remove(m_playerIndexes.localPlyrs.begin(), m_playerIndexes.localPlyrs.end(), pair<int,int>(i,m_input[i].second)), m_playerIndexes.localPlyrs.end());
 					m_input[i].second = -1;
 					//tell the network you've left
 					playersChanged = true;
@@ -271,8 +270,8 @@ Entity * PreGameScene::createBadge(int x, int y, bool isPlayer, int index)
 	ent->addComponent("Sprite", new SpriteComponent(pos, Vector2f(300, 300), Vector2f(300, 300), Scene::resources().getTexture("Pre Game Head" + std::to_string(index)), 1));
 	ent->addComponent("Ind Sprite", new SpriteComponent(indPos, Vector2f(200, 75), Vector2f(200, 75), Scene::resources().getTexture(isPlayer ? "Player Indicator" : "Cpu Indicator"), 1));
 
-	Scene::systems()["Render"]->addComponent(&ent->getComponent("Sprite"));
-	Scene::systems()["Render"]->addComponent(&ent->getComponent("Ind Sprite"));
+	Scene::systems().get<RenderSystem>()->addComponent(&ent->getComponent("Sprite"));
+	Scene::systems().get<RenderSystem>()->addComponent(&ent->getComponent("Ind Sprite"));
 
 	return ent;
 }
@@ -281,8 +280,8 @@ void PreGameScene::reconstructBadges()
 {
 	for (auto& badge : m_playerIcons)
 	{
-		Scene::systems()["Render"]->deleteComponent(&badge->getComponent("Sprite"));
-		Scene::systems()["Render"]->deleteComponent(&badge->getComponent("Ind Sprite"));
+		Scene::systems().get<RenderSystem>()->deleteComponent(&badge->getComponent("Sprite"));
+		Scene::systems().get<RenderSystem>()->deleteComponent(&badge->getComponent("Ind Sprite"));
 
 		delete &badge->getComponent("Pos");
 		delete &badge->getComponent("Ind Pos");
@@ -294,15 +293,15 @@ void PreGameScene::reconstructBadges()
 	//CLear ethe vector so we dont have redundant memory stored
 	m_playerIcons.clear();
 
-	for (auto index : playerIndexes.localPlyrs)
+	for (auto index : m_playerIndexes.localPlyrs)
 	{
 		m_playerIcons.push_back(createBadge(240 + 480 * index.second, 540, true, index.second));
 	}
-	for (auto index : playerIndexes.onlinePlyrs)
+	for (auto index : m_playerIndexes.onlinePlyrs)
 	{
 		m_playerIcons.push_back(createBadge(240 + 480 * index, 540, true, index));
 	}
-	for (auto index : playerIndexes.botPlyrs)
+	for (auto index : m_playerIndexes.botPlyrs)
 	{
 		m_playerIcons.push_back(createBadge(240 + 480 * index, 540, false, index));
 	}
@@ -311,19 +310,19 @@ void PreGameScene::reconstructBadges()
 void PreGameScene::checkForUpdates()
 {
 	vector<int> players = m_network->getPlayers();
-	playerIndexes.onlinePlyrs.clear();
-	//playerIndexes.botPlyrs.clear();
+	m_playerIndexes.onlinePlyrs.clear();
+	//m_playerIndexes.botPlyrs.clear();
 	for (auto num : players)
 	{
 		vector<int> localPlyrs;
-		for (auto l : playerIndexes.localPlyrs)
+		for (auto l : m_playerIndexes.localPlyrs)
 			localPlyrs.push_back(l.second);
-		//bool notInLocal = !(std::find(playerIndexes.localPlyrs.begin(), playerIndexes.localPlyrs.end(), num) != playerIndexes.localPlyrs.end());
+		//bool notInLocal = !(std::find(m_playerIndexes.localPlyrs.begin(), m_playerIndexes.localPlyrs.end(), num) != m_playerIndexes.localPlyrs.end());
 		bool notInLocal = !(std::find(localPlyrs.begin(), localPlyrs.end(), num) != localPlyrs.end());
-		bool notInBots = !(std::find(playerIndexes.botPlyrs.begin(), playerIndexes.botPlyrs.end(), num) != playerIndexes.botPlyrs.end());
+		bool notInBots = !(std::find(m_playerIndexes.botPlyrs.begin(), m_playerIndexes.botPlyrs.end(), num) != m_playerIndexes.botPlyrs.end());
 		if( notInLocal && notInBots)
 		{
-			playerIndexes.onlinePlyrs.push_back(num);
+			m_playerIndexes.onlinePlyrs.push_back(num);
 			m_availablePlyrs[num] = false;
 		}
 	}
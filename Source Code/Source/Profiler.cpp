@@ -0,0 +1,209 @@
+#include "Profiler.h"
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+
+Profiler::Profiler() :
+	m_frame(0),
+	m_tracing(false)
+{
+	m_frameZone = zoneId("Frame");
+	m_frameStart = Clock::now();
+}
+
+Profiler& Profiler::instance()
+{
+	static Profiler profiler;
+	return profiler;
+}
+
+int Profiler::zoneId(const std::string& name)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	for (int i = 0; i < (int)m_zones.size(); i++)
+	{
+		if (m_zones[i].name == name)
+			return i;
+	}
+
+	Zone zone;
+	zone.name = name;
+	zone.frameTotal = 0;
+	zone.hit = false;
+	zone.next = 0;
+	zone.last = 0;
+	m_zones.push_back(zone);
+	return m_zones.size() - 1;
+}
+
+/// <summary>
+/// Turns a thread into a small number
+/// for the trace, main thread is 0
+/// </summary>
+int Profiler::threadIndex(std::thread::id id)
+{
+	for (int i = 0; i < (int)m_threads.size(); i++)
+	{
+		if (m_threads[i] == id)
+			return i;
+	}
+
+	m_threads.push_back(id);
+	return m_threads.size() - 1;
+}
+
+/// <summary>
+/// Adds the time spent in a zone
+/// to the current frame
+/// </summary>
+void Profiler::record(int zone, Clock::time_point start, Clock::time_point end)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	auto& z = m_zones[zone];
+	z.frameTotal += std::chrono::duration<double, std::milli>(end - start).count();
+	z.hit = true;
+
+	if (m_tracing)
+	{
+		if (m_events.size() >= MAX_EVENTS)
+		{
+			std::cout << "Trace is full, stopping it" << std::endl;
+			writeTrace();
+			return;
+		}
+
+		Event e;
+		e.zone = zone;
+		e.thread = threadIndex(std::this_thread::get_id());
+		e.frame = m_frame;
+		e.start = std::chrono::duration_cast<std::chrono::microseconds>(start - m_traceStart).count();
+		e.duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+		m_events.push_back(e);
+	}
+}
+
+void Profiler::beginFrame()
+{
+	m_frameStart = Clock::now();
+}
+
+/// <summary>
+/// Times the whole frame and moves every zone
+/// that ran into its window of samples
+/// </summary>
+void Profiler::endFrame()
+{
+	record(m_frameZone, m_frameStart, Clock::now());
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	for (auto& zone : m_zones)
+	{
+		//Zones that didn't run this frame (eg. the game systems while in a menu) are left out instead of adding zeros
+		if (zone.hit == false)
+			continue;
+
+		if ((int)zone.samples.size() < WINDOW)
+			zone.samples.push_back(zone.frameTotal);
+		else
+			zone.samples[zone.next] = zone.frameTotal;
+		zone.next = (zone.next + 1) % WINDOW;
+
+		zone.last = zone.frameTotal;
+		zone.frameTotal = 0;
+		zone.hit = false;
+	}
+
+	m_frame++;
+}
+
+/// <summary>
+/// Works out the percentiles of every zone
+/// that has run inside the window
+/// </summary>
+std::vector<Profiler::Stats> Profiler::stats()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	std::vector<Stats> result;
+	std::vector<double> sorted;
+	for (auto& zone : m_zones)
+	{
+		if (zone.samples.empty())
+			continue;
+
+		sorted = zone.samples;
+		std::sort(sorted.begin(), sorted.end());
+
+		Stats s;
+		s.name = zone.name;
+		s.last = zone.last;
+		s.p50 = sorted[sorted.size() * 50 / 100];
+		s.p99 = sorted[std::min(sorted.size() - 1, sorted.size() * 99 / 100)];
+		result.push_back(s);
+	}
+
+	return result;
+}
+
+void Profiler::startTrace(const std::string& path)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	m_tracePath = path;
+	m_traceStart = Clock::now();
+	m_events.clear();
+	m_tracing = true;
+}
+
+void Profiler::stopTrace()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	if (m_tracing)
+		writeTrace();
+}
+
+/// <summary>
+/// Writes the captured events to the trace file,
+/// the mutex must already be locked
+/// </summary>
+void Profiler::writeTrace()
+{
+	m_tracing = false;
+
+	std::ofstream file(m_tracePath);
+	if (file.is_open() == false)
+	{
+		std::cout << "Unable to write trace " << m_tracePath << std::endl;
+		m_events.clear();
+		return;
+	}
+
+	auto json = m_tracePath.size() >= 5 && m_tracePath.compare(m_tracePath.size() - 5, 5, ".json") == 0;
+	if (json)
+	{
+		//Complete events ("ph":"X") already have their start and length so there's no begin/end to pair up
+		file << "{\"traceEvents\":[\n";
+		for (size_t i = 0; i < m_events.size(); i++)
+		{
+			auto& e = m_events[i];
+			file << "{\"name\":\"" << m_zones[e.zone].name << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << e.thread
+				<< ",\"ts\":" << e.start << ",\"dur\":" << e.duration << ",\"args\":{\"frame\":" << e.frame << "}}";
+			file << (i + 1 < m_events.size() ? ",\n" : "\n");
+		}
+		file << "]}\n";
+	}
+	else
+	{
+		file << "frame,zone,thread,start_us,duration_us\n";
+		for (auto& e : m_events)
+			file << e.frame << "," << m_zones[e.zone].name << "," << e.thread << "," << e.start << "," << e.duration << "\n";
+	}
+
+	std::cout << "Wrote " << m_events.size() << " trace events to " << m_tracePath << std::endl;
+	m_events.clear();
+	m_events.shrink_to_fit();
+}
@@ -0,0 +1,117 @@
+#include "ProfilerOverlay.h"
+#include <algorithm>
+#include <cstdio>
+
+ProfilerOverlay::ProfilerOverlay() :
+	m_visible(false),
+	m_stale(true),
+	m_font(nullptr),
+	m_text(nullptr),
+	m_textRect({ 0, 0, 0, 0 })
+{
+}
+
+ProfilerOverlay::~ProfilerOverlay()
+{
+	if (nullptr != m_text)
+		SDL_DestroyTexture(m_text);
+	if (nullptr != m_font)
+		TTF_CloseFont(m_font);
+}
+
+/// <summary>
+/// Renders every zone's line of text
+/// onto one texture
+/// </summary>
+void ProfilerOverlay::rebuild(SDL_Renderer& renderer)
+{
+	m_stats = Profiler::instance().stats();
+
+	if (nullptr != m_text)
+	{
+		SDL_DestroyTexture(m_text);
+		m_text = nullptr;
+	}
+
+	//The font is opened the first time it's needed, TTF_Init has been called by then
+	if (nullptr == m_font)
+		m_font = TTF_OpenFont("./Resources/fonts/arial.ttf", 16);
+	if (nullptr == m_font || m_stats.empty())
+		return;
+
+	auto surface = SDL_CreateRGBSurfaceWithFormat(0, 420, LINE_HEIGHT * (m_stats.size() + 1), 32, SDL_PIXELFORMAT_RGBA32);
+	if (nullptr == surface)
+		return;
+
+	SDL_Color white = { 255, 255, 255, 255 };
+	char line[128];
+	for (size_t i = 0; i <= m_stats.size(); i++)
+	{
+		if (i == 0)
+			snprintf(line, sizeof(line), "zone  last / p50 / p99 ms%s", Profiler::instance().tracing() ? "  (tracing)" : "");
+		else
+			snprintf(line, sizeof(line), "%s  %.2f / %.2f / %.2f", m_stats[i - 1].name.c_str(), m_stats[i - 1].last, m_stats[i - 1].p50, m_stats[i - 1].p99);
+
+		auto lineSurface = TTF_RenderText_Blended(m_font, line, white);
+		if (nullptr == lineSurface)
+			continue;
+
+		SDL_Rect dest = { BAR_WIDTH + 10, (int)i * LINE_HEIGHT, lineSurface->w, lineSurface->h };
+		SDL_BlitSurface(lineSurface, NULL, surface, &dest);
+		SDL_FreeSurface(lineSurface);
+	}
+
+	m_text = SDL_CreateTextureFromSurface(&renderer, surface);
+	m_textRect = { 10, 10, surface->w, surface->h };
+	SDL_FreeSurface(surface);
+}
+
+/// <summary>
+/// Draws the overlay on top of the frame,
+/// does nothing while it's hidden
+/// </summary>
+void ProfilerOverlay::draw(SDL_Renderer& renderer)
+{
+	if (m_visible == false)
+		return;
+
+	auto now = Profiler::Clock::now();
+	if (m_stale || std::chrono::duration<double>(now - m_built).count() >= REFRESH)
+	{
+		rebuild(renderer);
+		m_built = now;
+		m_stale = false;
+	}
+
+	Uint8 r, g, b, a;
+	SDL_BlendMode blend;
+	SDL_GetRenderDrawColor(&renderer, &r, &g, &b, &a);
+	SDL_GetRenderDrawBlendMode(&renderer, &blend);
+	SDL_SetRenderDrawBlendMode(&renderer, SDL_BLENDMODE_BLEND);
+
+	//Dark backing so the text can be read over the level
+	SDL_Rect back = { 0, 0, m_textRect.w + 20, LINE_HEIGHT * ((int)m_stats.size() + 1) + 20 };
+	SDL_SetRenderDrawColor(&renderer, 0, 0, 0, 180);
+	SDL_RenderFillRect(&renderer, &back);
+
+	for (size_t i = 0; i < m_stats.size(); i++)
+	{
+		auto y = 10 + (int)(i + 1) * LINE_HEIGHT + 4;
+		auto p50 = (int)(std::min(m_stats[i].p50 / BAR_MS, 1.0) * BAR_WIDTH);
+		auto p99 = (int)(std::min(m_stats[i].p99 / BAR_MS, 1.0) * BAR_WIDTH);
+
+		SDL_Rect bar = { 10, y, std::max(p50, 1), LINE_HEIGHT - 8 };
+		SDL_SetRenderDrawColor(&renderer, 0, 200, 255, 255);
+		SDL_RenderFillRect(&renderer, &bar);
+
+		SDL_Rect tail = { 10 + std::max(p99 - 2, 0), y, 2, LINE_HEIGHT - 8 };
+		SDL_SetRenderDrawColor(&renderer, 255, 60, 60, 255);
+		SDL_RenderFillRect(&renderer, &tail);
+	}
+
+	if (nullptr != m_text)
+		SDL_RenderCopy(&renderer, m_text, NULL, &m_textRect);
+
+	SDL_SetRenderDrawColor(&renderer, r, g, b, a);
+	SDL_SetRenderDrawBlendMode(&renderer, blend);
+}
@@ -0,0 +1,40 @@
+#include "Random.h"
+
+Random::Random(uint64_t seed)
+{
+	this->seed(seed);
+}
+
+void Random::seed(uint64_t seed)
+{
+	m_seed = seed;
+	m_state = 0;
+	(*this)();
+	m_state += seed;
+	(*this)();
+}
+
+/// <summary>
+/// Steps the state and scrambles
+/// the old one into 32 bits
+/// </summary>
+Random::result_type Random::operator()()
+{
+	auto old = m_state;
+	m_state = old * 6364136223846793005ULL + 1442695040888963407ULL;
+	auto xorShifted = (uint32_t)(((old >> 18) ^ old) >> 27);
+	auto rot = (uint32_t)(old >> 59);
+	return (xorShifted >> rot) | (xorShifted << ((32 - rot) & 31));
+}
+
+int Random::range(int count)
+{
+	if (count <= 0)
+		return 0;
+	return (int)(((uint64_t)(*this)() * (uint64_t)count) >> 32);
+}
+
+double Random::real()
+{
+	return (*this)() / 4294967296.0;
+}
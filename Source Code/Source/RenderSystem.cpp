@@ -1,68 +1,483 @@
 #include "../Header/RenderSystem.h"
+#include "Profiler.h"
+#include <cmath>
+#include <string>
 
-RenderSystem::RenderSystem()
+RenderSystem::RenderSystem() :
+	m_nextOrder(0),
+	m_frame(0),
+	m_alpha(1),
+	m_entitiesPtr(nullptr),
+	m_worldTarget(nullptr),
+	m_targetFailed(false)
 {
 }
 
+RenderSystem::~RenderSystem()
+{
+	if (nullptr != m_worldTarget)
+		SDL_DestroyTexture(m_worldTarget);
+}
+
 /// <summary>
-/// Add a new component to the vector
-/// in the renderSystem
+/// Add a new component to the bucket
+/// of its layer
 /// </summary>
 /// <param name="c"></param>
 void RenderSystem::addComponent(Component * c)
 {
-	m_components.push_back(c);
+	auto sprite = static_cast<SpriteComponent*>(c);
+	if (m_locations.count(sprite) || m_static.count(sprite))
+		return;
+
+	if (sprite->isStatic() && sprite->useCamera())
+		insertStatic(sprite, m_nextOrder++);
+	else
+		insert(sprite, m_nextOrder++);
+}
+
+/// <summary>
+/// Removes a sprite, the draw order comes
+/// from the layer and order so swapping
+/// inside the bucket is fine
+/// </summary>
+/// <param name="c"></param>
+void RenderSystem::deleteComponent(Component * c)
+{
+	auto sprite = static_cast<SpriteComponent*>(c);
+	if (removeStatic(sprite) == false)
+		remove(sprite);
+}
+
+void RenderSystem::removeAllComponents()
+{
+	m_layers.clear();
+	m_locations.clear();
+	m_grid.clear();
+	m_static.clear();
+	m_packedGrid.clear();
+	m_packedStatic.clear();
+	m_nextOrder = 0;
+}
+
+void RenderSystem::insert(SpriteComponent* sprite, unsigned int order)
+{
+	auto layer = sprite->getLayer();
+	auto& bucket = m_layers[layer];
+	m_locations[sprite] = { layer, bucket.size() };
+	bucket.push_back({ sprite, order });
+}
+
+void RenderSystem::remove(SpriteComponent* sprite)
+{
+	auto it = m_locations.find(sprite);
+	if (it == m_locations.end())
+		return;
+
+	auto& bucket = m_layers[it->second.layer];
+	auto index = it->second.index;
+
+	//Swap the last sprite of the bucket into the hole
+	bucket[index] = bucket.back();
+	m_locations[bucket[index].sprite].index = index;
+	bucket.pop_back();
+	m_locations.erase(sprite);
+}
+
+/// <summary>
+/// First and last grid cell a sprite of
+/// the size centred on the position covers
+/// </summary>
+SDL_Rect RenderSystem::cellsCovered(Vector2f pos, Vector2f size)
+{
+	//Floor so sprites left of or above the origin land in the right cell
+	SDL_Rect cells;
+	cells.x = (int)std::floor((pos.x - size.x / 2) / CELL_SIZE);
+	cells.y = (int)std::floor((pos.y - size.y / 2) / CELL_SIZE);
+	cells.w = (int)std::floor((pos.x + size.x / 2) / CELL_SIZE);
+	cells.h = (int)std::floor((pos.y + size.y / 2) / CELL_SIZE);
+	return cells;
+}
+
+/// <summary>
+/// Puts a static sprite into every
+/// grid cell its rect covers
+/// </summary>
+void RenderSystem::insertStatic(SpriteComponent* sprite, unsigned int order)
+{
+	auto cells = cellsCovered(sprite->getPosition(), sprite->getFrameSize());
+	for (int x = cells.x; x <= cells.w; x++)
+		for (int y = cells.y; y <= cells.h; y++)
+			m_grid[cellKey(x, y)].push_back(sprite);
+
+	m_static[sprite] = { order, cells, m_frame };
+}
+
+/// <summary>
+/// Puts a packed sprite into the cells it covers
+/// by its handle, screen space sprites aren't
+/// culled by the grid so they stay in the walk
+/// </summary>
+void RenderSystem::addStatic(EntityHandle handle)
+{
+	if (nullptr == m_entitiesPtr || m_packedStatic.count(handle.id()))
+		return;
+
+	auto sprite = m_entitiesPtr->components<SpriteComponent>().get(handle);
+	auto pos = m_entitiesPtr->components<PositionComponent>().get(handle);
+	if (nullptr == sprite || nullptr == pos || sprite->useCamera() == false)
+		return;
+
+	sprite->isStatic() = true;
+	auto cells = cellsCovered(pos->position, sprite->getFrameSize());
+	for (int x = cells.x; x <= cells.w; x++)
+		for (int y = cells.y; y <= cells.h; y++)
+			m_packedGrid[cellKey(x, y)].push_back(handle);
+
+	//Drawn in slot order like the rest of the packed sprites
+	m_packedStatic[handle.id()] = { handle.index(), cells, m_frame };
+}
+
+bool RenderSystem::removeStatic(SpriteComponent* sprite)
+{
+	auto it = m_static.find(sprite);
+	if (it == m_static.end())
+		return false;
+
+	auto& cells = it->second.cells;
+	for (int x = cells.x; x <= cells.w; x++)
+	{
+		for (int y = cells.y; y <= cells.h; y++)
+		{
+			auto& cell = m_grid[cellKey(x, y)];
+			cell.erase(std::remove(cell.begin(), cell.end(), sprite), cell.end());
+		}
+	}
+
+	m_static.erase(it);
+	return true;
+}
+
+/// <summary>
+/// Checks if a rect, rotated around its
+/// centre, touches the area
+/// </summary>
+bool RenderSystem::overlaps(const SDL_Rect& rect, float angle, const SDL_Rect& area)
+{
+	auto r = rect;
 
-	//Sort the sprite components based on their layers
-	std::sort(m_components.begin(), m_components.end(), layerSorter());
+	//A rotated sprite can reach out to its diagonal, grow the rect to cover that
+	if (angle != 0)
+	{
+		auto diagonal = (int)std::ceil(std::sqrt((float)(r.w * r.w + r.h * r.h)));
+		r.x -= (diagonal - r.w) / 2 + 1;
+		r.y -= (diagonal - r.h) / 2 + 1;
+		r.w = r.h = diagonal + 2;
+	}
+
+	return r.x < area.x + area.w && r.x + r.w > area.x && r.y < area.y + area.h && r.y + r.h > area.y;
+}
+
+/// <summary>
+/// Adds the sprite to this frame's draw
+/// list if any of it is on screen
+/// </summary>
+/// <param name="pos">Where the sprite is drawn this frame</param>
+void RenderSystem::addVisible(SpriteComponent* sprite, Vector2f pos, unsigned int order, Camera& camera, const SDL_Rect& area)
+{
+	if (sprite->isVisible() == false)
+		return;
+
+	auto dest = destRect(sprite, pos, camera);
+	if (overlaps(dest, sprite->getAngle(), area) == false)
+		return;
+
+	DrawItem item = { sprite, sprite->getTexture().texture, sprite->getLayer(), order, dest };
+	if (sprite->useCamera())
+		m_worldItems.push_back(item);
+	else
+		m_screenItems.push_back(item);
 }
 
 /// <summary>
-/// Uses SDL_RenderCopy to draw
-/// object using parametres from 
-/// the component class
+/// Draws every sprite, world sprites first with the
+/// camera zoom and then the screen space sprites on
+/// top at their normal size
 /// </summary>
 void RenderSystem::render(SDL_Renderer& renderer, Camera& camera)
 {
-	camera.setZoom(&renderer);
+	PROFILE_ZONE("Render");
+	m_worldItems.clear();
+	m_screenItems.clear();
+	m_frame++;
+
+	//Work out how much of the world the view covers before culling against it
+	camera.setBlend(m_alpha);
+	camera.updateView();
+	auto worldArea = camera.visibleArea();
+	SDL_Rect viewArea = { 0, 0, worldArea.w, worldArea.h }; //The visible area once the camera is taken off
+	SDL_Rect screenArea = { 0, 0, 1920, 1080 };
 
-	//Loop through all 
-	for (auto c : m_components)
+	//Only look in the grid cells the camera can see
+	int firstX = (int)std::floor(worldArea.x / (float)CELL_SIZE), lastX = (int)std::floor((worldArea.x + worldArea.w) / (float)CELL_SIZE);
+	int firstY = (int)std::floor(worldArea.y / (float)CELL_SIZE), lastY = (int)std::floor((worldArea.y + worldArea.h) / (float)CELL_SIZE);
+	for (int x = firstX; x <= lastX; x++)
 	{
-		//Convert component to a sprite
-		auto sprite = dynamic_cast<SpriteComponent*>(c);
+		for (int y = firstY; y <= lastY; y++)
+		{
+			auto cell = m_grid.find(cellKey(x, y));
+			if (cell == m_grid.end())
+				continue;
 
-		m_spritePos = sprite->getDestRect(); //Can modify the position using the camera later
+			for (auto sprite : cell->second)
+			{
+				auto& entry = m_static[sprite];
+				if (entry.frame == m_frame)
+					continue;
+				entry.frame = m_frame;
+				addVisible(sprite, sprite->getDrawPosition(m_alpha), entry.order, camera, viewArea);
+			}
 
-		//position of the destination rect using the position ptr
-		m_spritePos.x = sprite->getPosition().x - (sprite->getFrameSize().x / 2);
-		m_spritePos.y = sprite->getPosition().y - (sprite->getFrameSize().y / 2);
+			if (nullptr == m_entitiesPtr)
+				continue;
+			auto packed = m_packedGrid.find(cellKey(x, y));
+			if (packed == m_packedGrid.end())
+				continue;
 
-		//Minus camera when we do a camera
-		if (sprite->useCamera())
+			for (auto handle : packed->second)
+			{
+				auto& entry = m_packedStatic[handle.id()];
+				if (entry.frame == m_frame)
+					continue;
+				entry.frame = m_frame;
+
+				auto sprite = m_entitiesPtr->components<SpriteComponent>().get(handle);
+				auto pos = m_entitiesPtr->components<PositionComponent>().get(handle);
+				if (nullptr != sprite && nullptr != pos)
+					addVisible(sprite, pos->drawPosition(m_alpha), entry.order, camera, viewArea);
+			}
+		}
+	}
+
+	for (auto& layer : m_layers)
+	{
+		for (auto& entry : layer.second)
 		{
-			m_spritePos.x -= camera.x();
-			m_spritePos.y -= camera.y();
+			//The sprite changed layer since it was added, move it to the right bucket after this loop
+			if (entry.sprite->getLayer() != layer.first)
+				m_moved.push_back(entry);
+
+			addVisible(entry.sprite, entry.sprite->getDrawPosition(m_alpha), entry.order, camera, entry.sprite->useCamera() ? viewArea : screenArea);
 		}
+	}
 
-		auto scalar = camera.getScale();
-		if (sprite->useCamera() == false)
+	//The packed sprites in order, their positions are looked up by entity. Sprites on the same layer and texture
+	//draw in the order their entities' slots are in. The static ones were found through the grid
+	if (nullptr != m_entitiesPtr)
+	{
+		auto& sprites = m_entitiesPtr->components<SpriteComponent>();
+		auto& positions = m_entitiesPtr->components<PositionComponent>();
+		for (size_t i = 0; i < sprites.size(); i++)
 		{
-			camera.scalar() = 1;
-			camera.setZoom(&renderer);
+			auto& sprite = sprites[i];
+			if (sprite.isStatic())
+				continue;
+
+			auto owner = sprites.owner(i);
+			auto pos = positions.get(owner);
+			if (nullptr == pos)
+				continue;
+
+			addVisible(&sprite, pos->drawPosition(m_alpha), owner.index(), camera, sprite.useCamera() ? viewArea : screenArea);
 		}
+	}
 
-		//Draw the sprite
-		SDL_RenderCopyEx(&renderer, sprite->getTexture(), &sprite->getSourceRect(), &m_spritePos, sprite->getAngle(), 0, sprite->getFlip());
+	for (auto& entry : m_moved)
+	{
+		remove(entry.sprite);
+		insert(entry.sprite, entry.order);
+	}
+	m_moved.clear();
+
+	//Zoom the world in one copy, fall back to scaling the renderer if we can't draw to a texture
+	if (drawWorldToTarget(renderer, camera) == false)
+	{
+		camera.setZoom(&renderer);
+		drawPass(renderer, camera, m_worldItems);
+		SDL_RenderSetScale(&renderer, 1.0f, 1.0f);
+	}
+
+	drawPass(renderer, camera, m_screenItems);
+}
+
+/// <summary>
+/// Draws the world sprites into an offscreen texture
+/// at their normal size, then copies the part the
+/// camera sees onto the screen stretched to fill it
+/// </summary>
+/// <returns>False if there is no camera or the target couldn't be made</returns>
+bool RenderSystem::drawWorldToTarget(SDL_Renderer& renderer, Camera& camera)
+{
+	if (camera.isActive() == false || m_targetFailed)
+		return false;
+
+	if (nullptr == m_worldTarget)
+	{
+		//Filter the stretch so zooming between whole pixels stays smooth
+		auto quality = SDL_GetHint(SDL_HINT_RENDER_SCALE_QUALITY);
+		std::string oldQuality = nullptr == quality ? "0" : quality;
+		SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, "linear");
+		m_worldTarget = SDL_CreateTexture(&renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, 1920, 1080);
+		SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, oldQuality.c_str());
+
+		if (nullptr == m_worldTarget)
+		{
+			m_targetFailed = true;
+			return false;
+		}
+	}
+
+	if (SDL_SetRenderTarget(&renderer, m_worldTarget) != 0)
+	{
+		m_targetFailed = true;
+		return false;
+	}
+
+	SDL_RenderClear(&renderer);
+	drawPass(renderer, camera, m_worldItems);
+	SDL_SetRenderTarget(&renderer, NULL);
 
-		if (sprite->useCamera() == false)
+	//The view is the size of the world on screen, stretch that much of the target over the whole screen
+	SDL_Rect src = { 0, 0, camera.m_view.w, camera.m_view.h };
+	SDL_RenderCopy(&renderer, m_worldTarget, &src, NULL);
+	return true;
+}
+
+/// <summary>
+/// Sorts the items and draws each run
+/// of sprites that share a texture
+/// </summary>
+void RenderSystem::drawPass(SDL_Renderer& renderer, Camera& camera, std::vector<DrawItem>& items)
+{
+	std::sort(items.begin(), items.end());
+
+	size_t runStart = 0;
+	for (size_t i = 1; i <= items.size(); i++)
+	{
+		if (i == items.size() || items[i].texture != items[runStart].texture)
 		{
-			camera.scalar() = scalar;
-			camera.setZoom(&renderer);
+			drawRun(renderer, camera, items.data() + runStart, items.data() + i);
+			runStart = i;
 		}
 	}
 }
 
+/// <summary>
+/// Gets where the sprite goes on screen
+/// </summary>
+SDL_Rect RenderSystem::destRect(SpriteComponent* sprite, Vector2f pos, Camera& camera)
+{
+	auto rect = sprite->getDestRect();
+
+	//position of the destination rect, blended between the last two steps
+	rect.x = pos.x - (sprite->getFrameSize().x / 2);
+	rect.y = pos.y - (sprite->getFrameSize().y / 2);
+
+	if (sprite->useCamera())
+	{
+		rect.x -= camera.x();
+		rect.y -= camera.y();
+	}
+
+	return rect;
+}
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+/// <summary>
+/// Builds one quad per sprite and sends
+/// the whole run in a single draw call
+/// </summary>
+void RenderSystem::drawRun(SDL_Renderer& renderer, Camera& camera, const DrawItem* begin, const DrawItem* end)
+{
+	auto texture = begin->texture;
+	if (nullptr == texture)
+		return;
+
+	int texW, texH;
+	SDL_QueryTexture(texture, NULL, NULL, &texW, &texH);
+
+	//Geometry ignores the texture's colour and alpha mod so pass them through the vertices
+	SDL_Color colour;
+	SDL_GetTextureColorMod(texture, &colour.r, &colour.g, &colour.b);
+	SDL_GetTextureAlphaMod(texture, &colour.a);
+
+	m_vertices.clear();
+	m_indices.clear();
+
+	for (auto item = begin; item != end; item++)
+	{
+		auto sprite = item->sprite;
+		m_spritePos = item->dest;
+		auto src = sprite->getPageRect();
+
+		float u0 = src.x / (float)texW, u1 = (src.x + src.w) / (float)texW;
+		float v0 = src.y / (float)texH, v1 = (src.y + src.h) / (float)texH;
+		if (sprite->getFlip() & SDL_FLIP_HORIZONTAL)
+			std::swap(u0, u1);
+		if (sprite->getFlip() & SDL_FLIP_VERTICAL)
+			std::swap(v0, v1);
+
+		//Corners relative to the centre, rotated the same way SDL_RenderCopyEx does
+		float halfW = m_spritePos.w / 2.0f, halfH = m_spritePos.h / 2.0f;
+		float cx = m_spritePos.x + halfW, cy = m_spritePos.y + halfH;
+		float rad = sprite->getAngle() * (float)M_PI / 180.0f;
+		float c = std::cos(rad), s = std::sin(rad);
+
+		const float corners[4][4] = {
+			{ -halfW, -halfH, u0, v0 },
+			{ halfW, -halfH, u1, v0 },
+			{ halfW, halfH, u1, v1 },
+			{ -halfW, halfH, u0, v1 }
+		};
+
+		auto first = (int)m_vertices.size();
+		for (auto& corner : corners)
+		{
+			SDL_Vertex vertex;
+			vertex.position.x = cx + corner[0] * c - corner[1] * s;
+			vertex.position.y = cy + corner[0] * s + corner[1] * c;
+			vertex.color = colour;
+			vertex.tex_coord.x = corner[2];
+			vertex.tex_coord.y = corner[3];
+			m_vertices.push_back(vertex);
+		}
+
+		const int quad[6] = { 0, 1, 2, 2, 3, 0 };
+		for (auto index : quad)
+			m_indices.push_back(first + index);
+	}
+
+	SDL_RenderGeometry(&renderer, texture, m_vertices.data(), (int)m_vertices.size(), m_indices.data(), (int)m_indices.size());
+}
+#else
+/// <summary>
+/// SDL before 2.0.18 has no geometry call, the run
+/// is still drawn back to back with one texture bound
+/// </summary>
+void RenderSystem::drawRun(SDL_Renderer& renderer, Camera& camera, const DrawItem* begin, const DrawItem* end)
+{
+	for (auto item = begin; item != end; item++)
+	{
+		auto sprite = item->sprite;
+		m_spritePos = item->dest;
+
+		//Draw the sprite
+		auto src = sprite->getPageRect();
+		SDL_RenderCopyEx(&renderer, item->texture, &src, &m_spritePos, sprite->getAngle(), 0, sprite->getFlip());
+	}
+}
+#endif
+
 /// <summary>
 /// Loops through render components
 /// creates SDL_Rects using their values
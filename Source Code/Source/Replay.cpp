@@ -0,0 +1,210 @@
+#include "Replay.h"
+#include <fstream>
+#include <iostream>
+
+namespace
+{
+	//Bit order of the input mask, new buttons go on the end so old replays still read back
+	const char* BUTTONS[] = { "W", "A", "S", "D", "C", "Space", "ABTN", "XBTN", "BBTN", "YBTN", "LBBTN", "RBBTN", "MINUS", "PLUS",
+		"STICKUP", "STICKDOWN", "STICKLEFT", "STICKRIGHT", "STICKDOWNLEFT", "STICKDOWNRIGHT", "STICKUPLEFT", "STICKUPRIGHT" };
+	const int BUTTON_COUNT = sizeof(BUTTONS) / sizeof(BUTTONS[0]);
+
+	//Commands an online player can be sent, 0 is no command
+	const char* COMMANDS[] = { "", "JUMP", "UPPERCUT", "PUNCH", "KICK", "MOVE LEFT", "MOVE RIGHT", "FALL", "SUPER", "RESPAWN" };
+	const int COMMAND_COUNT = sizeof(COMMANDS) / sizeof(COMMANDS[0]);
+	const uint8_t HAS_SYNC = 0x80;
+}
+
+Replay::Replay() :
+	m_seed(0),
+	m_levelHash(0),
+	m_ticks(0),
+	m_read(0),
+	m_ticksRead(0)
+{
+}
+
+/// <summary>
+/// FNV-1a hash of the level data so a replay
+/// isn't played back on a different level
+/// </summary>
+uint64_t Replay::hashLevel(const json& level)
+{
+	uint64_t hash = 14695981039346656037ULL;
+	for (auto c : level.dump())
+	{
+		hash ^= (uint8_t)c;
+		hash *= 1099511628211ULL;
+	}
+	return hash;
+}
+
+void Replay::begin(uint64_t seed, uint64_t levelHash, const std::vector<Player>& players)
+{
+	m_seed = seed;
+	m_levelHash = levelHash;
+	m_players = players;
+	m_ticks = 0;
+	m_data.clear();
+	rewind();
+}
+
+void Replay::write(const void* data, size_t size)
+{
+	auto bytes = static_cast<const uint8_t*>(data);
+	m_data.insert(m_data.end(), bytes, bytes + size);
+}
+
+/// <summary>
+/// Reads the next bytes of the recording,
+/// past the end reads as zeros
+/// </summary>
+void Replay::read(void* data, size_t size)
+{
+	auto bytes = static_cast<uint8_t*>(data);
+	for (size_t i = 0; i < size; i++)
+		bytes[i] = m_read < m_data.size() ? m_data[m_read++] : 0;
+}
+
+void Replay::recordInput(const Input* input)
+{
+	uint32_t mask = 0;
+	if (nullptr != input)
+	{
+		for (int i = 0; i < BUTTON_COUNT; i++)
+		{
+			auto it = input->find(BUTTONS[i]);
+			if (it != input->end() && it->second)
+				mask |= 1u << i;
+		}
+	}
+	write(&mask, sizeof(mask));
+}
+
+void Replay::recordOnline(const std::string* command, const OnlineSendComponent::syncStruct* sync)
+{
+	uint8_t id = 0;
+	for (int i = 1; nullptr != command && i < COMMAND_COUNT; i++)
+	{
+		if (*command == COMMANDS[i])
+			id = i;
+	}
+
+	if (nullptr != sync)
+		id |= HAS_SYNC;
+	write(&id, sizeof(id));
+
+	if (nullptr != sync)
+	{
+		float values[6] = { sync->pos.x, sync->pos.y, sync->vel.x, sync->vel.y, sync->dvel.x, sync->dvel.y };
+		write(values, sizeof(values));
+	}
+}
+
+void Replay::readInput(Input& input)
+{
+	uint32_t mask;
+	read(&mask, sizeof(mask));
+
+	for (int i = 0; i < BUTTON_COUNT; i++)
+		input[BUTTONS[i]] = (mask & (1u << i)) != 0;
+}
+
+bool Replay::readOnline(std::string& command, OnlineSendComponent::syncStruct& sync)
+{
+	uint8_t id;
+	read(&id, sizeof(id));
+
+	auto commandId = id & ~HAS_SYNC;
+	command = commandId < COMMAND_COUNT ? COMMANDS[commandId] : "";
+
+	if ((id & HAS_SYNC) == 0)
+		return false;
+
+	float values[6];
+	read(values, sizeof(values));
+	sync.pos = Vector2f(values[0], values[1]);
+	sync.vel = Vector2f(values[2], values[3]);
+	sync.dvel = Vector2f(values[4], values[5]);
+	return true;
+}
+
+/// <summary>
+/// Writes the replay out, numbers are stored as they are
+/// in memory (little endian on everything we build for)
+/// </summary>
+bool Replay::save(const std::string& path) const
+{
+	std::ofstream file(path, std::ios::binary);
+	if (file.is_open() == false)
+	{
+		std::cout << "Unable to write replay " << path << std::endl;
+		return false;
+	}
+
+	uint8_t count = m_players.size();
+	file.write((const char*)&MAGIC, sizeof(MAGIC));
+	file.write((const char*)&VERSION, sizeof(VERSION));
+	file.write((const char*)&m_seed, sizeof(m_seed));
+	file.write((const char*)&m_levelHash, sizeof(m_levelHash));
+	file.write((const char*)&count, sizeof(count));
+	for (auto& player : m_players)
+	{
+		uint8_t type = player.type, index = player.index;
+		file.write((const char*)&type, sizeof(type));
+		file.write((const char*)&index, sizeof(index));
+	}
+
+	uint32_t size = m_data.size();
+	file.write((const char*)&m_ticks, sizeof(m_ticks));
+	file.write((const char*)&size, sizeof(size));
+	file.write((const char*)m_data.data(), m_data.size());
+	return file.good();
+}
+
+bool Replay::load(const std::string& path)
+{
+	std::ifstream file(path, std::ios::binary);
+	if (file.is_open() == false)
+	{
+		std::cout << "Unable to open replay " << path << std::endl;
+		return false;
+	}
+
+	uint32_t magic = 0;
+	uint16_t version = 0;
+	file.read((char*)&magic, sizeof(magic));
+	file.read((char*)&version, sizeof(version));
+	if (magic != MAGIC || version != VERSION)
+	{
+		std::cout << path << " is not a replay this version can read" << std::endl;
+		return false;
+	}
+
+	uint8_t count = 0;
+	file.read((char*)&m_seed, sizeof(m_seed));
+	file.read((char*)&m_levelHash, sizeof(m_levelHash));
+	file.read((char*)&count, sizeof(count));
+	m_players.clear();
+	for (int i = 0; i < count; i++)
+	{
+		uint8_t type = 0, index = 0;
+		file.read((char*)&type, sizeof(type));
+		file.read((char*)&index, sizeof(index));
+		m_players.push_back({ (PlayerType)type, index });
+	}
+
+	uint32_t size = 0;
+	file.read((char*)&m_ticks, sizeof(m_ticks));
+	file.read((char*)&size, sizeof(size));
+	m_data.resize(size);
+	file.read((char*)m_data.data(), size);
+	rewind();
+
+	if (file.good() == false)
+	{
+		std::cout << "Replay " << path << " is cut short" << std::endl;
+		return false;
+	}
+	return true;
+}
@@ -1,7 +1,9 @@
 #include "ResourceManager.h"
+#include <algorithm>
 
 ResourceHandler::ResourceHandler(std::string filePath) :
-	m_filePath(filePath)
+	m_filePath(filePath),
+	m_rendererPtr(nullptr)
 {
 }
 
@@ -12,12 +14,19 @@ ResourceHandler::~ResourceHandler()
 //Load all of our textures we need for the game
 void ResourceHandler::loadTextures(SDL_Renderer& renderer)
 {
+	m_rendererPtr = &renderer;
+
 	//Load level data first
 	loadLevelData();
 
 	//Load achievement data
 	loadAchievements();
 
+	//Pages can't be bigger than the renderer allows
+	SDL_RendererInfo info;
+	if (SDL_GetRendererInfo(&renderer, &info) == 0 && info.max_texture_width > 0 && info.max_texture_height > 0)
+		m_atlas.setPageSize(std::min(m_atlas.pageSize(), std::min(info.max_texture_width, info.max_texture_height)));
+
 	//Load textures here
 	//You do not need to include the entire path, the resource manager
 	//Will look for everything in the Resources folder, so you then need to only provide th erest of the path to the file
@@ -26,76 +35,76 @@ void ResourceHandler::loadTextures(SDL_Renderer& renderer)
 	//If you had the player.png in another folder, then youd call it like this
 	//loadFromPath("Characters/Player.png")
 
-	m_map["Game BG0"] = loadFromPath("Backgrounds-01.png", renderer);
-	m_map["Game BG1"] = loadFromPath("Backgrounds-02.png", renderer);
-	m_map["Game BG2"] = loadFromPath("Backgrounds-03.png", renderer);
-	m_map["Game BG3"] = loadFromPath("Backgrounds-04.png", renderer);
-	m_map["Credits"] = loadFromPath("credits.png", renderer);
+	addImage("Game BG0", "Backgrounds-01.png");
+	addImage("Game BG1", "Backgrounds-02.png");
+	addImage("Game BG2", "Backgrounds-03.png");
+	addImage("Game BG3", "Backgrounds-04.png");
+	addImage("Credits", "credits.png");
 
 	auto colours = std::vector<std::string>({ "Green", "Blue", "Orange", "Pink" });
 
 	for (int i = 0; i < 4; i++)
 	{
-		m_map["Player Run" + std::to_string(i)] = loadFromPath("Player/" + colours.at(i) + "/Player_Run.png", renderer);
-		m_map["Player Idle" + std::to_string(i)] = loadFromPath("Player/" + colours.at(i) + "/Player_Idle.png", renderer);
-		m_map["Player Ground Kick" + std::to_string(i)] = loadFromPath("Player/" + colours.at(i) + "/Player_Kick.png", renderer);
-		m_map["Player Jump" + std::to_string(i)] = loadFromPath("Player/" + colours.at(i) + "/Player_Jump.png", renderer);
-		m_map["Player Super Stun" + std::to_string(i)] = loadFromPath("Player/" + colours.at(i) + "/Player_Super_Stun.png", renderer);
-		m_map["Player Small Stun" + std::to_string(i)] = loadFromPath("Player/" + colours.at(i) + "/Player_Small_Stun.png", renderer);
-		m_map["Player Big Stun" + std::to_string(i)] = loadFromPath("Player/" + colours.at(i) + "/Player_Big_Stun.png", renderer);
-		m_map["Player Uppercut" + std::to_string(i)] = loadFromPath("Player/" + colours.at(i) + "/Player_Uppercut.png", renderer);
-		m_map["Player Left Punch" + std::to_string(i)] = loadFromPath("Player/" + colours.at(i) + "/Left_Hand_Punch.png", renderer);
-		m_map["Player Right Punch" + std::to_string(i)] = loadFromPath("Player/" + colours.at(i) + "/Right_Hand_Punch.png", renderer);
+		addImage("Player Run" + std::to_string(i), "Player/" + colours.at(i) + "/Player_Run.png");
+		addImage("Player Idle" + std::to_string(i), "Player/" + colours.at(i) + "/Player_Idle.png");
+		addImage("Player Ground Kick" + std::to_string(i), "Player/" + colours.at(i) + "/Player_Kick.png");
+		addImage("Player Jump" + std::to_string(i), "Player/" + colours.at(i) + "/Player_Jump.png");
+		addImage("Player Super Stun" + std::to_string(i), "Player/" + colours.at(i) + "/Player_Super_Stun.png");
+		addImage("Player Small Stun" + std::to_string(i), "Player/" + colours.at(i) + "/Player_Small_Stun.png");
+		addImage("Player Big Stun" + std::to_string(i), "Player/" + colours.at(i) + "/Player_Big_Stun.png");
+		addImage("Player Uppercut" + std::to_string(i), "Player/" + colours.at(i) + "/Player_Uppercut.png");
+		addImage("Player Left Punch" + std::to_string(i), "Player/" + colours.at(i) + "/Left_Hand_Punch.png");
+		addImage("Player Right Punch" + std::to_string(i), "Player/" + colours.at(i) + "/Right_Hand_Punch.png");
 	}
 
-	m_map["Player Run"] = loadFromPath("Player/Player_Run.png", renderer);
-	m_map["Player Idle"] = loadFromPath("Player/Player_Idle.png", renderer);
-	m_map["Player Ground Kick"] = loadFromPath("Player/Player_Kick.png", renderer);
-	m_map["Player Dust"] = loadFromPath("Player/Dust.png", renderer);
-	m_map["Player Left Punch"] = loadFromPath("Player/Left_Hand_Punch.png", renderer);
-	m_map["Player Right Punch"] = loadFromPath("Player/Right_Hand_Punch.png", renderer);
-	m_map["Player Jump"] = loadFromPath("Player/Player_Jump.png", renderer);
-	m_map["Player Super Stun"] = loadFromPath("Player/Player_Super_Stun.png", renderer);
-	m_map["Player Small Stun"] = loadFromPath("Player/Player_Small_Stun.png", renderer);
-	m_map["Player Big Stun"] = loadFromPath("Player/Player_Big_Stun.png", renderer);
-	m_map["Record"] = loadFromPath("Record/Record.png", renderer);
+	addImage("Player Run", "Player/Player_Run.png");
+	addImage("Player Idle", "Player/Player_Idle.png");
+	addImage("Player Ground Kick", "Player/Player_Kick.png");
+	addImage("Player Dust", "Player/Dust.png");
+	addImage("Player Left Punch", "Player/Left_Hand_Punch.png");
+	addImage("Player Right Punch", "Player/Right_Hand_Punch.png");
+	addImage("Player Jump", "Player/Player_Jump.png");
+	addImage("Player Super Stun", "Player/Player_Super_Stun.png");
+	addImage("Player Small Stun", "Player/Player_Small_Stun.png");
+	addImage("Player Big Stun", "Player/Player_Big_Stun.png");
+	addImage("Record", "Record/Record.png");
 	//Load all 3 platform pieces for each colour
 	for (int i = 0; i < 3; i++)
 	{
-		m_map["Booth" + std::to_string(i)] = loadFromPath("DJBooth/DJBooth" + std::to_string(i) + ".png", renderer);
+		addImage("Booth" + std::to_string(i), "DJBooth/DJBooth" + std::to_string(i) + ".png");
 	}
 
 	//Loading in GUI
-	m_map["Button BG"] = loadFromPath("GUI/Button_BG.png", renderer);
-	m_map["Exit Button"] = loadFromPath("GUI/ExitButton.png", renderer);
-	m_map["Local Play Button"] = loadFromPath("GUI/LocalButton.png", renderer);
-	m_map["Multiplayer Button"] = loadFromPath("GUI/MultiButton.png", renderer);
-	m_map["Options Button"] = loadFromPath("GUI/OptionsButton.png", renderer);
-	m_map["Lobby BG"] = loadFromPath("GUI/Lobby_Browser.png", renderer);
-	m_map["Lobby Bar"] = loadFromPath("GUI/Lobby_Info_Bar.png", renderer);
-	m_map["Lobby Bar Selected"] = loadFromPath("GUI/Lobby_Info_Bar_Selected.png", renderer);
-	m_map["Numbers"] = loadFromPath("GUI/Numbers.png", renderer);
-	m_map["Password Yes"] = loadFromPath("GUI/Yes_Password.png", renderer);
-	m_map["Password No"] = loadFromPath("GUI/No_Password.png", renderer);
-	m_map["Achievements Button"] = loadFromPath("GUI/AchievementsButton.png", renderer);
-	m_map["Achievements BG"] = loadFromPath("GUI/Achievements_Screen.png", renderer);
-	m_map["Achievement Locked"] = loadFromPath("Achievements/Achievement_Locked.png", renderer);
-	m_map["Achievement Selected"] = loadFromPath("Achievements/Achievement Selected.png", renderer);
-	m_map["Achievement Des Box"] = loadFromPath("Achievements/Achievement Description Box.png", renderer);
-	m_map["Achievement Banner"] = loadFromPath("Achievements/Achievement_Banner.png", renderer);
-	m_map["Portrait"] = loadFromPath("GUI/Portrait.png", renderer);
-	m_map["Numbers Coloured"] = loadFromPath("GUI/Numbers Coloured.png", renderer);
-	m_map["Logo"] = loadFromPath("Logo.png", renderer);
-	m_map["Head0"] = loadFromPath("GUI/Green Head.png", renderer);
-	m_map["Head1"] = loadFromPath("GUI/Blue Head.png", renderer);
-	m_map["Head2"] = loadFromPath("GUI/Orange Head.png", renderer);
-	m_map["Head3"] = loadFromPath("GUI/Pink Head.png", renderer);
-	m_map["Pre Game BG"] = loadFromPath("GUI/Pre_Game_BG.png", renderer);
-	m_map["Player Indicator"] = loadFromPath("GUI/Player Indicator.png", renderer);
-	m_map["Cpu Indicator"] = loadFromPath("GUI/Cpu Indicator.png", renderer);
+	addImage("Button BG", "GUI/Button_BG.png");
+	addImage("Exit Button", "GUI/ExitButton.png");
+	addImage("Local Play Button", "GUI/LocalButton.png");
+	addImage("Multiplayer Button", "GUI/MultiButton.png");
+	addImage("Options Button", "GUI/OptionsButton.png");
+	addImage("Lobby BG", "GUI/Lobby_Browser.png");
+	addImage("Lobby Bar", "GUI/Lobby_Info_Bar.png");
+	addImage("Lobby Bar Selected", "GUI/Lobby_Info_Bar_Selected.png");
+	addImage("Numbers", "GUI/Numbers.png");
+	addImage("Password Yes", "GUI/Yes_Password.png");
+	addImage("Password No", "GUI/No_Password.png");
+	addImage("Achievements Button", "GUI/AchievementsButton.png");
+	addImage("Achievements BG", "GUI/Achievements_Screen.png");
+	addImage("Achievement Locked", "Achievements/Achievement_Locked.png");
+	addImage("Achievement Selected", "Achievements/Achievement Selected.png");
+	addImage("Achievement Des Box", "Achievements/Achievement Description Box.png");
+	addImage("Achievement Banner", "Achievements/Achievement_Banner.png");
+	addImage("Portrait", "GUI/Portrait.png");
+	addImage("Numbers Coloured", "GUI/Numbers Coloured.png");
+	addImage("Logo", "Logo.png");
+	addImage("Head0", "GUI/Green Head.png");
+	addImage("Head1", "GUI/Blue Head.png");
+	addImage("Head2", "GUI/Orange Head.png");
+	addImage("Head3", "GUI/Pink Head.png");
+	addImage("Pre Game BG", "GUI/Pre_Game_BG.png");
+	addImage("Player Indicator", "GUI/Player Indicator.png");
+	addImage("Cpu Indicator", "GUI/Cpu Indicator.png");
 
 	for(int i = 0; i < colours.size(); i++)
-		m_map["Pre Game Head" + std::to_string(i)] = loadFromPath("GUI/Pre Game Head" + std::to_string(i) + ".png", renderer);
+		addImage("Pre Game Head" + std::to_string(i), "GUI/Pre Game Head" + std::to_string(i) + ".png");
 
 
 	std::vector<std::string> names({ "Punch First",
@@ -118,16 +127,16 @@ void ResourceHandler::loadTextures(SDL_Renderer& renderer)
 	//Achievements
 	for (int i = 0; i < names.size(); i++)
 	{
-		m_map[names.at(i)] = loadFromPath("Achievements/" + names.at(i) + ".png", renderer);
-		m_map[names.at(i) + " Des"] = loadFromPath("Achievements/" + names.at(i) + " Des.png", renderer);
+		addImage(names.at(i), "Achievements/" + names.at(i) + ".png");
+		addImage(names.at(i) + " Des", "Achievements/" + names.at(i) + " Des.png");
 	}
 
 	//Game start animations
-	m_map["Timer 1"] = loadFromPath("GUI/1 Timer.png", renderer);
-	m_map["Timer 2"] = loadFromPath("GUI/2 Timer.png", renderer);
-	m_map["Timer 3"] = loadFromPath("GUI/3 Timer.png", renderer);
-	m_map["Timer Fight"] = loadFromPath("GUI/Fight Timer.png", renderer);
-	m_map["Winner"] = loadFromPath("GUI/Winner.png", renderer);
+	addImage("Timer 1", "GUI/1 Timer.png");
+	addImage("Timer 2", "GUI/2 Timer.png");
+	addImage("Timer 3", "GUI/3 Timer.png");
+	addImage("Timer Fight", "GUI/Fight Timer.png");
+	addImage("Winner", "GUI/Winner.png");
 
 	//The colours of the platforms
 	for (auto& colour : colours)
@@ -135,10 +144,15 @@ void ResourceHandler::loadTextures(SDL_Renderer& renderer)
 		//Load all 3 platform pieces for each colour
 		for (int i = 0; i < 3; i++)
 		{
-			m_map["Platform " + colour + " " + std::to_string(i)] = loadFromPath("Platforms/" + colour + "/" + std::to_string(i) + ".png", renderer);
+			addImage("Platform " + colour + " " + std::to_string(i), "Platforms/" + colour + "/" + std::to_string(i) + ".png");
 		}
 	}
 
+	//Pack everything that fit into the atlas and upload the pages
+	m_atlas.build(renderer);
+	for (auto& region : m_atlas.regions())
+		m_map[region.first] = region.second;
+
 	//All the Audio Files
 	m_music["Along Song"] = MusicLoadFromPath("Audio/ATG.ogg");
 	m_sfx["Calculations"] = SFXLoadFromPath("Audio/Calculations.wav");
@@ -195,6 +209,35 @@ void ResourceHandler::loadAchievements()
 	m_achievementData = json::parse(content);
 }
 
+/// <summary>
+/// Loads an image and queues it for the atlas,
+/// images too big for a page get their own texture
+/// </summary>
+void ResourceHandler::addImage(const std::string& name, const std::string& fileName)
+{
+	std::string path = m_filePath + fileName;
+
+	SDL_Surface* loadedS = IMG_Load(path.c_str());
+	if (loadedS == NULL)
+	{
+		std::cout << "Error loading image at path " << path << std::endl;
+		m_map[name] = TextureRegion();
+		return;
+	}
+
+	if (m_atlas.add(name, loadedS))
+		return;
+
+	auto texture = SDL_CreateTextureFromSurface(m_rendererPtr, loadedS);
+	if (texture == NULL)
+		std::cout << "Unable to create texture" << std::endl;
+	else
+		m_textures.push_back(texture);
+
+	m_map[name] = TextureRegion(texture);
+	SDL_FreeSurface(loadedS);
+}
+
 SDL_Texture* ResourceHandler::loadFromPath(std::string fileName, SDL_Renderer& renderer)
 {
 	std::string path = m_filePath + fileName;
@@ -246,12 +289,17 @@ Mix_Music * ResourceHandler::MusicLoadFromPath(std::string fileName)
 
 void ResourceHandler::destroyTextures()
 {
-	//Loop through our map
-	for (auto& texture : m_map)
-	{
-		//Destroy the texture
-		SDL_DestroyTexture(texture.second);
-	}
+	//Destroy the textures that weren't packed and then the atlas pages
+	for (auto texture : m_textures)
+		SDL_DestroyTexture(texture);
+
+	m_textures.clear();
+	m_atlas.destroy();
+
+	for (auto& platform : m_platformTextures)
+		SDL_DestroyTexture(platform.second);
+	m_platformTextures.clear();
+	m_map.clear();
 }
 
 TTF_Font* ResourceHandler::loadFont(std::string filePath, std::string name)
@@ -266,11 +314,57 @@ TTF_Font * ResourceHandler::getFont(std::string name)
 	return m_fontMap[name];
 }
 
-SDL_Texture * ResourceHandler::getTexture(std::string name)
+TextureRegion ResourceHandler::getTexture(std::string name)
 {
 	return m_map.at(name);
 }
 
+/// <summary>
+/// Gets the texture of a platform, tiled from the
+/// platform pieces of that colour. Built the first
+/// time it is asked for and kept for every match after
+/// </summary>
+SDL_Texture * ResourceHandler::getPlatformTexture(int w, int h, const std::string& tag, const std::string& colour)
+{
+	auto key = std::make_tuple(w, h, tag, colour);
+	auto it = m_platformTextures.find(key);
+	if (it != m_platformTextures.end())
+		return it->second;
+
+	auto size = tag == "Floor" ? 50 : 25;
+	int numOfTiles = w / size;
+	SDL_Rect srcRect = { 0, 0, 50, 50 };
+
+	//Create the texture for the platform
+	auto texture = SDL_CreateTexture(m_rendererPtr, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_TARGET, w, h);
+	SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+	//Set it to draw to the texture we just created
+	SDL_SetRenderTarget(m_rendererPtr, texture);
+
+	//Start from a see through texture, keep the draw colour the game clears the screen with
+	Uint8 r, g, b, a;
+	SDL_GetRenderDrawColor(m_rendererPtr, &r, &g, &b, &a);
+	SDL_SetRenderDrawColor(m_rendererPtr, 0, 0, 0, 0);
+	SDL_RenderClear(m_rendererPtr);
+	SDL_SetRenderDrawColor(m_rendererPtr, r, g, b, a);
+
+	//Loop through the tiles and draw the shape of the platform, end pieces on either side
+	for (int i = 0; i < numOfTiles; i++)
+	{
+		SDL_Rect rect = { i * size, 0, size, size };
+		auto piece = i == 0 ? 0 : i == numOfTiles - 1 ? 2 : 1;
+
+		//The tiles live in the atlas so the source rect has to be moved onto their page
+		auto tile = getTexture("Platform " + colour + " " + std::to_string(piece));
+		auto tileSrc = tile.toPage(srcRect);
+		SDL_RenderCopy(m_rendererPtr, tile.texture, &tileSrc, &rect);
+	}
+	SDL_SetRenderTarget(m_rendererPtr, NULL);
+
+	m_platformTextures[key] = texture;
+	return texture;
+}
+
 Mix_Chunk * ResourceHandler::getSFX(std::string name)
 {
 	return m_sfx[name];
@@ -0,0 +1,106 @@
+#include "SystemScheduler.h"
+#include "Profiler.h"
+
+SystemScheduler::SystemScheduler(WorkerPool * workers) :
+	m_workersPtr(workers),
+	m_built(false),
+	m_profiled(true)
+{
+}
+
+void SystemScheduler::add(System * system, const std::string& name, bool scaled)
+{
+	m_entries.push_back({ system, scaled, Profiler::instance().zoneId(name) });
+	m_built = false;
+}
+
+void SystemScheduler::clear()
+{
+	m_entries.clear();
+	m_waves.clear();
+	m_built = false;
+}
+
+/// <summary>
+/// Works out the wave of every system,
+/// only done again when the systems change
+/// </summary>
+void SystemScheduler::build()
+{
+	m_waves.clear();
+
+	std::vector<SystemAccess> access;
+	std::vector<int> wave(m_entries.size(), 0);
+
+	for (auto& entry : m_entries)
+		access.push_back(entry.system->access());
+
+	for (int i = 0; i < (int)m_entries.size(); i++)
+	{
+		//Go after every earlier system we conflict with
+		for (int j = 0; j < i; j++)
+		{
+			if (access[i].conflicts(access[j]) && wave[j] + 1 > wave[i])
+				wave[i] = wave[j] + 1;
+		}
+
+		if (wave[i] >= (int)m_waves.size())
+			m_waves.resize(wave[i] + 1);
+		m_waves[wave[i]].push_back(i);
+	}
+
+	m_built = true;
+}
+
+const std::vector<std::vector<int>>& SystemScheduler::waves()
+{
+	if (m_built == false)
+		build();
+	return m_waves;
+}
+
+void SystemScheduler::runEntry(const Entry & entry, double dt, float timeScale)
+{
+	if (m_profiled == false)
+	{
+		entry.system->update(entry.scaled ? dt * timeScale : dt);
+		return;
+	}
+
+	ProfileZone zone(entry.zone);
+	entry.system->update(entry.scaled ? dt * timeScale : dt);
+}
+
+/// <summary>
+/// Updates every system, a wave at a time
+/// </summary>
+/// <param name="dt">Frame time</param>
+/// <param name="timeScale">Multiplier for the systems that were added as scaled</param>
+void SystemScheduler::run(double dt, float timeScale)
+{
+	if (m_built == false)
+		build();
+
+	for (auto& wave : m_waves)
+	{
+		//With no workers or a single system just run on this thread
+		if (nullptr == m_workersPtr || m_workersPtr->size() == 0 || wave.size() == 1)
+		{
+			for (auto index : wave)
+				runEntry(m_entries[index], dt, timeScale);
+			continue;
+		}
+
+		//Hand all but the first system to the workers and run the first one here, the pool may be shared so only wait on this wave
+		WorkerPool::Group group;
+		for (size_t i = 1; i < wave.size(); i++)
+		{
+			auto entry = m_entries[wave[i]];
+			m_workersPtr->push([this, entry, dt, timeScale]() { runEntry(entry, dt, timeScale); }, group);
+		}
+
+		runEntry(m_entries[wave[0]], dt, timeScale);
+
+		m_workersPtr->wait(group);
+	}
+}
@@ -0,0 +1,128 @@
+#include "TextureAtlas.h"
+#include <algorithm>
+#include <iostream>
+
+TextureAtlas::TextureAtlas(int pageSize, int padding) :
+	m_pageSize(pageSize),
+	m_padding(padding)
+{
+}
+
+TextureAtlas::~TextureAtlas()
+{
+	//Surfaces that were never built still need freeing, the pages are left to destroy()
+	for (auto& pending : m_pending)
+		SDL_FreeSurface(pending.surface);
+}
+
+/// <summary>
+/// Queues an image to be packed, the atlas
+/// takes ownership of the surface
+/// </summary>
+/// <returns>False if the image can't fit on a page, the surface is left with the caller</returns>
+bool TextureAtlas::add(const std::string& name, SDL_Surface* surface)
+{
+	if (nullptr == surface || surface->w + m_padding > m_pageSize || surface->h + m_padding > m_pageSize)
+		return false;
+
+	m_pending.push_back({ name, surface });
+	return true;
+}
+
+/// <summary>
+/// Packs every queued image and uploads
+/// the pages, each page is one texture
+/// </summary>
+void TextureAtlas::build(SDL_Renderer& renderer)
+{
+	//Tallest first so each shelf wastes as little height as possible, names keep the layout the same every run
+	std::sort(m_pending.begin(), m_pending.end(), [](const Pending& a, const Pending& b) {
+		if (a.surface->h != b.surface->h)
+			return a.surface->h > b.surface->h;
+		return a.name < b.name;
+	});
+
+	struct Placement
+	{
+		int page;
+		SDL_Rect rect;
+	};
+	std::vector<Placement> placements;
+	std::vector<int> pageHeights;
+
+	int page = -1, x = 0, shelfY = 0, shelfH = 0;
+	for (auto& pending : m_pending)
+	{
+		auto w = pending.surface->w, h = pending.surface->h;
+
+		//Start a new shelf when this row is full
+		if (page >= 0 && x + w > m_pageSize)
+		{
+			shelfY += shelfH + m_padding;
+			x = 0;
+			shelfH = 0;
+		}
+		//Start a new page when the shelves reach the bottom
+		if (page < 0 || shelfY + h > m_pageSize)
+		{
+			page++;
+			pageHeights.push_back(0);
+			x = 0;
+			shelfY = 0;
+			shelfH = 0;
+		}
+
+		placements.push_back({ page, { x, shelfY, w, h } });
+		x += w + m_padding;
+		shelfH = std::max(shelfH, h);
+		pageHeights[page] = std::max(pageHeights[page], shelfY + h);
+	}
+
+	//Draw the images onto each page, the page is only as tall as it needs to be
+	for (int p = 0; p < (int)pageHeights.size(); p++)
+	{
+		auto surface = SDL_CreateRGBSurfaceWithFormat(0, m_pageSize, pageHeights[p], 32, SDL_PIXELFORMAT_RGBA32);
+		if (nullptr == surface)
+		{
+			std::cout << "Unable to create atlas page " << SDL_GetError() << std::endl;
+			m_pages.push_back(nullptr);
+			continue;
+		}
+
+		for (size_t i = 0; i < m_pending.size(); i++)
+		{
+			if (placements[i].page != p)
+				continue;
+
+			//Copy the pixels as they are instead of blending them onto the empty page
+			SDL_SetSurfaceBlendMode(m_pending[i].surface, SDL_BLENDMODE_NONE);
+			SDL_BlitSurface(m_pending[i].surface, NULL, surface, &placements[i].rect);
+		}
+
+		auto texture = SDL_CreateTextureFromSurface(&renderer, surface);
+		if (nullptr == texture)
+			std::cout << "Unable to create atlas texture" << std::endl;
+		else
+			SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+
+		m_pages.push_back(texture);
+		SDL_FreeSurface(surface);
+	}
+
+	for (size_t i = 0; i < m_pending.size(); i++)
+	{
+		m_regions[m_pending[i].name] = TextureRegion(m_pages[placements[i].page], placements[i].rect);
+		SDL_FreeSurface(m_pending[i].surface);
+	}
+
+	m_pending.clear();
+}
+
+void TextureAtlas::destroy()
+{
+	for (auto page : m_pages)
+		SDL_DestroyTexture(page);
+
+	m_pages.clear();
+	m_regions.clear();
+}
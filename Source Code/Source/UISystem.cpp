@@ -2,9 +2,11 @@
 #include "PlayerComponent.h"
 #include "PlayerPhysicsComponent.h"
 #include "SpriteComponent.h"
+#include "UIDigitsComponent.h"
 
-UISystem::UISystem(std::map<Entity*, Entity*>* uimap) :
-	m_map(uimap)
+UISystem::UISystem(std::map<EntityHandle, Entity*>* uimap, EntityManager* entities) :
+	m_map(uimap),
+	m_entitiesPtr(entities)
 {
 }
 
@@ -17,18 +19,19 @@ void UISystem::update(double dt)
 	for (auto& pair : *m_map)
 	{
 		//Get a pointer to the player the ui belongs to
-		auto player = pair.first;
+		auto player = m_entitiesPtr->get(pair.first);
 		//Get a pointer to the ui entity that belongs to the player
 		auto ui = pair.second;
 
-		auto dmg = std::to_string(static_cast<PlayerPhysicsComponent*>(&player->getComponent("Player Physics"))->damagePercentage());
-		auto p = static_cast<PlayerComponent*>(&player->getComponent("Player"));
-
-		if (static_cast<PlayerPhysicsComponent*>(&player->getComponent("Player Physics"))->isSupered())
-		{
-			auto phys = static_cast<PlayerPhysicsComponent*>(&player->getComponent("Player Physics"));
+		//Leave the ui as it was if the player has been knocked out
+		if (nullptr == player)
+			continue;
 
+		auto p = player->get<PlayerComponent>();
+		auto phys = player->get<PlayerPhysicsComponent>();
 
+		if (phys->isSupered())
+		{
 			if (phys->superPercentage() > 0)
 			{
 				p->m_superPercentSpeed -= dt;
@@ -45,26 +48,9 @@ void UISystem::update(double dt)
 			p->m_superPercentSpeed = 0.05f;
 		}
 
-		auto super = std::to_string(static_cast<PlayerPhysicsComponent*>(&player->getComponent("Player Physics"))->superPercentage());
-
-		if(dmg.size() < 3)
-			dmg.insert(dmg.begin(), 3 - dmg.length(), '0');
-		if (super.size() < 3)
-			super.insert(super.begin(), 3 - super.length(), '0');
-
-		//Updating damage number
-		for (int i = 0; i < 3; i++)
-		{
-			auto dNum =  (int)dmg.at(i) - 48;
-			auto s = static_cast<SpriteComponent*>(&ui->getComponent("Dmg" + std::to_string(i)));
-			s->setTextureRect({32 *dNum,0,32,32});
-		}
-		//Updating super number
-		for (int i = 0; i < 3; i++)
-		{
-			auto sNum = (int)super.at(i) - 48;
-			auto s = static_cast<SpriteComponent*>(&ui->getComponent("Sup" + std::to_string(i)));
-			s->setTextureRect({ 32 * sNum,0,32,32 });
-		}
+		//Only changes the digit sprites when a number is different to what is on screen
+		auto digits = ui->get<UIDigitsComponent>();
+		digits->showDamage(phys->damagePercentage());
+		digits->showSuper(phys->superPercentage());
 	}
 }
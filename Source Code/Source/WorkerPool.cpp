@@ -0,0 +1,111 @@
+#include "WorkerPool.h"
+#include <algorithm>
+
+WorkerPool::WorkerPool(unsigned int workers) :
+	m_running(0),
+	m_stop(false)
+{
+	for (unsigned int i = 0; i < workers; i++)
+		m_threads.emplace_back(&WorkerPool::work, this);
+}
+
+WorkerPool::~WorkerPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_stop = true;
+	}
+	m_jobAdded.notify_all();
+
+	for (auto& thread : m_threads)
+		thread.join();
+}
+
+void WorkerPool::push(std::function<void()> job)
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_jobs.push_back({ std::move(job), nullptr });
+		m_running++;
+	}
+	m_jobAdded.notify_one();
+}
+
+void WorkerPool::push(std::function<void()> job, Group & group)
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_jobs.push_back({ std::move(job), &group });
+		m_running++;
+		group.m_running++;
+	}
+	m_jobAdded.notify_one();
+}
+
+/// <summary>
+/// Blocks until all queued jobs are done
+/// </summary>
+void WorkerPool::wait()
+{
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_jobsDone.wait(lock, [this]() { return m_running == 0; });
+}
+
+/// <summary>
+/// Blocks until the group's jobs are done. Rather than sit
+/// behind jobs other callers queued first, this thread
+/// takes the group's jobs that are still queued and runs them
+/// </summary>
+/// <param name="group">The group the jobs were pushed under</param>
+void WorkerPool::wait(Group & group)
+{
+	std::unique_lock<std::mutex> lock(m_mutex);
+	while (group.m_running > 0)
+	{
+		auto it = std::find_if(m_jobs.begin(), m_jobs.end(), [&group](const Job& job) { return job.group == &group; });
+		if (it == m_jobs.end())
+		{
+			//All of them have been started, wait for the workers to finish them
+			m_jobsDone.wait(lock);
+			continue;
+		}
+
+		auto job = std::move(*it);
+		m_jobs.erase(it);
+		lock.unlock();
+		job.run();
+		lock.lock();
+		finished(&group);
+	}
+}
+
+void WorkerPool::finished(Group * group)
+{
+	m_running--;
+	if (nullptr != group)
+		group->m_running--;
+	m_jobsDone.notify_all();
+}
+
+void WorkerPool::work()
+{
+	while (true)
+	{
+		Job job;
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_jobAdded.wait(lock, [this]() { return m_stop || !m_jobs.empty(); });
+
+			if (m_stop && m_jobs.empty())
+				return;
+
+			job = std::move(m_jobs.front());
+			m_jobs.pop_front();
+		}
+
+		job.run();
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+		finished(job.group);
+	}
+}